@@ -112,19 +112,21 @@ Runuran_init (SEXP sexp_obj, SEXP sexp_distr, SEXP sexp_method)
 /*---------------------------------------------------------------------------*/
 
 SEXP
-Runuran_sample (SEXP sexp_unur, SEXP sexp_n)
+Runuran_sample (SEXP sexp_unur, SEXP sexp_n, SEXP sexp_threads)
      /*----------------------------------------------------------------------*/
      /* Sample from UNU.RAN generator object.                                */
      /*                                                                      */
      /* Parameters:                                                          */
-     /*   unur ... 'Runuran' object (S4 class)                               */ 
-     /*   n    ... sample size (positive integer)                            */
+     /*   unur    ... 'Runuran' object (S4 class)                            */ 
+     /*   n       ... sample size (positive integer)                         */
+     /*   threads ... number of threads (positive integer)                   */
      /*                                                                      */
      /* Return:                                                              */
      /*   random sample of size 'n'                                          */
      /*----------------------------------------------------------------------*/
 {
   int n;
+  int threads;
   SEXP sexp_gen;
   SEXP sexp_data;
   struct unur_gen *gen;
@@ -139,13 +141,21 @@ Runuran_sample (SEXP sexp_unur, SEXP sexp_n)
     Rf_error("sample size 'n' must be positive integer");
   }
 
+  /* Extract and check number of threads */
+  threads = *(INTEGER (Rf_coerceVector(sexp_threads, INTSXP)));
+  if (threads == NA_INTEGER || threads<=0) {
+    Rf_error("number of 'threads' must be positive integer");
+  }
+
   /* Extract pointer to UNU.RAN generator */
   sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
   if (! Rf_isNull(sexp_gen)) {
     CHECK_UNUR_PTR(sexp_gen);
     gen = R_ExternalPtrAddr(sexp_gen);
     if (gen != NULL) {
-      return _Runuran_sample_unur(gen,n);
+      return ((threads > 1)
+	      ? _Runuran_sample_unur_threads(gen,n,threads)
+	      : _Runuran_sample_unur(gen,n));
     }
   }
 
@@ -179,9 +189,18 @@ _Runuran_sample_unur (struct unur_gen *gen, int n)
   int i,k;
   SEXP sexp_res = R_NilValue;
   double *res;
+  int native;
+
+  /* a native URNG does not use the R built-in URNG */
+  native = _Runuran_has_native_urng(gen);
 
   /* get state for the R built-in URNG */
-  GetRNGstate();
+  if (!native) GetRNGstate();
+
+  /* discard uniform random numbers that are left over in a buffered */
+  /* URNG from an earlier call. They do not depend on the current    */
+  /* state of the R built-in URNG.                                   */
+  unur_urng_flush_buffer(unur_get_urng(gen));
 
   /* generate random vector of length n */
   switch (unur_distr_get_type(unur_get_distr(gen))) {
@@ -189,27 +208,44 @@ _Runuran_sample_unur (struct unur_gen *gen, int n)
   case UNUR_DISTR_CONT:   /* univariate continuous distribution */
   case UNUR_DISTR_CEMP:   /* empirical continuous univariate distribution */
     PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
-    for (i=0; i<n; i++) {
-      REAL(sexp_res)[i] = unur_sample_cont(gen); }
+    /* fill result vector using the batch sampling routine of the method */
+    unur_sample_cont_array(gen, REAL(sexp_res), n);
     break;
 
   case UNUR_DISTR_DISCR:  /* discrete univariate distribution */
-    PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
-    for (i=0; i<n; i++) {
-      REAL(sexp_res)[i] = (double) unur_sample_discr(gen); }
+    {
+      /* we sample into a small integer buffer and copy into the result */
+      int *K = (int*) R_alloc(RUNURAN_SAMPLE_BLOCK, sizeof(int));
+      PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+      res = REAL(sexp_res);
+      for (i=0; i<n; i+=RUNURAN_SAMPLE_BLOCK) {
+	int nb = (n-i < RUNURAN_SAMPLE_BLOCK) ? n-i : RUNURAN_SAMPLE_BLOCK;
+	unur_sample_discr_array(gen, K, nb);
+	for (k=0; k<nb; k++) res[i+k] = (double) K[k];
+      }
+    }
     break;
 
   case UNUR_DISTR_CVEC:   /* continuous mulitvariate distribution */
     {
+      /* we sample blocks of vectors (stored row by row) into a buffer */
+      /* and copy them into the columns of the result matrix.          */
+      /* Vectors that could not be generated are set to NA.            */
       int dim = unur_get_dimension(gen);
-      double *x = (double*) R_alloc(dim, sizeof(double) );
+      int nblock = RUNURAN_SAMPLE_BLOCK / dim + 1;
+      int j, status;
+      double *x = (double*) R_alloc(nblock * dim, sizeof(double) );
       PROTECT(sexp_res = Rf_allocMatrix(REALSXP, n, dim));
       res = REAL(sexp_res);
-      for (i=0; i<n; i++) {
-	if (unur_sample_vec(gen,x)!=UNUR_SUCCESS)
-	  for (k=0; k<dim; k++) res[i + n*k] = NA_REAL;
-	else
-	  for (k=0; k<dim; k++) res[i + n*k] = x[k];
+      for (i=0; i<n; i+=nblock) {
+	int nb = (n-i < nblock) ? n-i : nblock;
+	status = unur_sample_vec_array(gen, x, nb);
+	for (j=0; j<nb; j++) {
+	  if (status!=UNUR_SUCCESS && !R_FINITE(x[j*dim]))
+	    for (k=0; k<dim; k++) res[i+j + n*k] = NA_REAL;
+	  else
+	    for (k=0; k<dim; k++) res[i+j + n*k] = x[j*dim + k];
+	}
       }
     }
     break;
@@ -222,7 +258,7 @@ _Runuran_sample_unur (struct unur_gen *gen, int n)
   }
 
   /* update state for the R built-in URNG */
-  PutRNGstate();
+  if (!native) PutRNGstate();
 
   /* return result to R */
   UNPROTECT(1);
@@ -247,13 +283,29 @@ _Runuran_sample_data (SEXP sexp_data, int n)
 {
   SEXP sexp_res = R_NilValue;
   int mid = INTEGER(VECTOR_ELT(sexp_data,0))[0];   /* method ID */
+  struct Runuran_packed data;
+
+  /* get tables */
+  _Runuran_get_packed(&data, sexp_data, R_NilValue);
 
   /* get state for the R built-in URNG */
   GetRNGstate();
 
   switch (mid) {
   case UNUR_METH_PINV:
-    PROTECT(sexp_res = _Runuran_sample_pinv(sexp_data,n));
+    PROTECT(sexp_res = _Runuran_sample_pinv(&data,n));
+    break;
+  case UNUR_METH_HINV:
+    PROTECT(sexp_res = _Runuran_sample_hinv(&data,n));
+    break;
+  case UNUR_METH_DGT:
+    PROTECT(sexp_res = _Runuran_sample_dgt(&data,n));
+    break;
+  case UNUR_METH_DAU:
+    PROTECT(sexp_res = _Runuran_sample_dau(&data,n));
+    break;
+  case UNUR_METH_TDR:
+    PROTECT(sexp_res = _Runuran_sample_tdr(&data,n));
     break;
   default:
     Rf_errorcall(R_NilValue,"[UNU.RAN - error] broken UNU.RAN object");
@@ -270,6 +322,92 @@ _Runuran_sample_data (SEXP sexp_data, int n)
 
 /*---------------------------------------------------------------------------*/
 
+SEXP
+Runuran_sample_sorted (SEXP sexp_unur, SEXP sexp_n)
+     /*----------------------------------------------------------------------*/
+     /* Draw sorted random sample from UNU.RAN generator object that         */
+     /* implements an inversion method.                                      */
+     /* A sorted sample of uniform random numbers is generated directly by   */
+     /* means of exponential spacings and then transformed by the quantile   */
+     /* function which walks the interval tables only once.                  */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur    ... 'Runuran' object (S4 class)                            */ 
+     /*   n       ... sample size (positive integer)                         */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   sorted random sample of size 'n'                                   */
+     /*----------------------------------------------------------------------*/
+{
+  int i,n;
+  double S;
+  double *U;
+  SEXP sexp_gen;
+  SEXP sexp_data;
+  SEXP sexp_U;
+  SEXP sexp_res = R_NilValue;
+  struct unur_gen *gen;
+  int native;
+
+  /* first argument must be S4 class */
+  if (!Rf_isS4(sexp_unur))
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN object");
+
+  /* Extract and check sample size */
+  n = *(INTEGER (Rf_coerceVector(sexp_n, INTSXP)));
+  if (n<=0) {
+    Rf_error("sample size 'n' must be positive integer");
+  }
+
+  /* check whether UNU.RAN object implements inversion method */
+  if ( ! LOGICAL(R_do_slot(sexp_unur, Rf_install("inversion")))[0]) {
+    Rf_error("[UNU.RAN - error] invalid UNU.RAN object: inversion method required!");
+  }
+
+  /* Extract pointer to UNU.RAN generator */
+  sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+  if (! Rf_isNull(sexp_gen)) {
+    CHECK_UNUR_PTR(sexp_gen);
+    gen = R_ExternalPtrAddr(sexp_gen);
+    if (gen != NULL) {
+      native = _Runuran_has_native_urng(gen);
+      if (!native) GetRNGstate();
+      unur_urng_flush_buffer(unur_get_urng(gen));
+      PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+      /* sorted uniforms, then quantiles in place */
+      unur_urng_sample_sorted(unur_get_urng(gen), REAL(sexp_res), n);
+      unur_quantile_array(gen, REAL(sexp_res), REAL(sexp_res), n);
+      if (!native) PutRNGstate();
+      UNPROTECT(1);
+      return sexp_res;
+    }
+  }
+
+  /* Extract data list */
+  sexp_data = R_do_slot(sexp_unur, Rf_install("data"));
+  if (! Rf_isNull(sexp_data)) {
+    /* packed objects always use the R built-in URNG */
+    PROTECT(sexp_U = Rf_allocVector(REALSXP, n));
+    U = REAL(sexp_U);
+    GetRNGstate();
+    for (S=0., i=0; i<n; i++)
+      U[i] = (S += exp_rand());
+    S += exp_rand();
+    PutRNGstate();
+    for (i=0; i<n; i++)
+      U[i] /= S;
+    sexp_res = _Runuran_quantile_data(sexp_data,sexp_U,sexp_unur);
+    UNPROTECT(1);
+    return sexp_res;
+  }
+
+  /* Neither the UNU.RAN object nor the packed data list exists */
+  Rf_errorcall(R_NilValue,"[UNU.RAN - error] broken UNU.RAN object");
+ 
+} /* end of Runuran_sample_sorted() */
+
+/*---------------------------------------------------------------------------*/
+
 SEXP 
 Runuran_quantile (SEXP sexp_unur, SEXP sexp_U)
      /*----------------------------------------------------------------------*/
@@ -349,7 +487,6 @@ _Runuran_quantile_unur (struct unur_gen *gen, SEXP sexp_U)
 {
   double *U;
   int n = 1;
-  int i;
   SEXP sexp_res = R_NilValue;
 
   /* Extract U */
@@ -357,14 +494,9 @@ _Runuran_quantile_unur (struct unur_gen *gen, SEXP sexp_U)
   n = Rf_length(sexp_U);
 
   /* evaluate inverse CDF */
+  /* (if NA or NaN is given then we simply return the same value) */
   PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
-  for (i=0; i<n; i++) {
-    if (ISNAN(U[i]))
-      /* if NA or NaN is given then we simply return the same value */
-      REAL(sexp_res)[i] = U[i];
-    else 
-      REAL(sexp_res)[i] = unur_quantile(gen,U[i]); 
-  }
+  unur_quantile_array(gen, U, REAL(sexp_res), n);
   UNPROTECT(1);
 
   /* return result to R */
@@ -390,10 +522,20 @@ _Runuran_quantile_data (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur)
 {
   SEXP sexp_res = R_NilValue;
   int mid = INTEGER(VECTOR_ELT(sexp_data,0))[0];   /* method ID */
+  struct Runuran_packed data;
+
+  /* get tables */
+  _Runuran_get_packed(&data, sexp_data, R_do_slot(sexp_unur, Rf_install("dom")));
 
   switch (mid) {
   case UNUR_METH_PINV:
-    return _Runuran_quantile_pinv(sexp_data,sexp_U,sexp_unur);
+    return _Runuran_quantile_pinv(&data,sexp_U);
+    break;
+  case UNUR_METH_HINV:
+    return _Runuran_quantile_hinv(&data,sexp_U);
+    break;
+  case UNUR_METH_DGT:
+    return _Runuran_quantile_dgt(&data,sexp_U);
     break;
   default:
     Rf_errorcall(R_NilValue,"[UNU.RAN - error] broken UNU.RAN object");
@@ -406,6 +548,66 @@ _Runuran_quantile_data (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur)
 
 /*---------------------------------------------------------------------------*/
 
+void
+_Runuran_get_packed (struct Runuran_packed *packed, SEXP sexp_data, SEXP sexp_dom)
+     /*----------------------------------------------------------------------*/
+     /* Get tables of packed generator object.                               */
+     /* The tables are either stored in the R data list or in a table file   */
+     /* that is mapped into memory.                                          */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   packed ... pointer to structure for storing tables [output]        */
+     /*   data   ... data for generation method (R list)                     */
+     /*   dom    ... domain of distribution (R vector or R_NilValue)         */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  SEXP sexp_slot;
+
+  /* tables in mapped file */
+  if (_Runuran_table_is_mapped(sexp_data)) {
+    _Runuran_table_get(packed, sexp_data);
+    return;
+  }
+
+  /* tables in R list */
+  packed->n_slots = Rf_length(sexp_data);
+  if (packed->n_slots > RUNURAN_PACKED_MAX_SLOTS)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] broken UNU.RAN object");
+
+  for (i=0; i<packed->n_slots; i++) {
+    sexp_slot = VECTOR_ELT(sexp_data, i);
+    switch (TYPEOF(sexp_slot)) {
+    case INTSXP:
+      packed->table[i] = INTEGER(sexp_slot); break;
+    case LGLSXP:
+      packed->table[i] = LOGICAL(sexp_slot); break;
+    case REALSXP:
+      packed->table[i] = REAL(sexp_slot); break;
+    default:
+      /* e.g., R functions */
+      packed->table[i] = NULL;
+    }
+    packed->length[i] = Rf_length(sexp_slot);
+  }
+
+  /* domain of distribution */
+  if (TYPEOF(sexp_dom) == REALSXP && Rf_length(sexp_dom) == 2) {
+    packed->dom[0] = REAL(sexp_dom)[0];
+    packed->dom[1] = REAL(sexp_dom)[1];
+  }
+  else {
+    packed->dom[0] = R_NegInf;
+    packed->dom[1] = R_PosInf;
+  }
+
+  /* R data list is required for R objects (like PDF for method TDR) */
+  packed->list = sexp_data;
+
+} /* end of _Runuran_get_packed() */
+
+/*---------------------------------------------------------------------------*/
+
 SEXP
 Runuran_PDF (SEXP sexp_obj, SEXP sexp_x, SEXP sexp_islog)
      /*----------------------------------------------------------------------*/
@@ -779,6 +981,7 @@ _Runuran_free (SEXP sexp_gen)
      /*----------------------------------------------------------------------*/
 {
   struct unur_gen *gen;
+  UNUR_URNG *urng;
 
 #ifdef RUNURAN_DEBUG
   /* check pointer */
@@ -794,9 +997,14 @@ _Runuran_free (SEXP sexp_gen)
   }
 
   /* free generator object */
+  urng = unur_get_urng(gen);
   unur_free(gen);
   R_ClearExternalPtr(sexp_gen);
 
+  /* free buffered or native URNG owned by generator object (if any) */
+  if (urng != unur_get_default_urng())
+    unur_urng_free(urng);
+
 } /* end of _Runuran_free() */
 
 /*---------------------------------------------------------------------------*/
@@ -840,14 +1048,25 @@ Runuran_pack (SEXP sexp_unur)
   case UNUR_METH_PINV:
     _Runuran_pack_pinv(gen, sexp_unur);
     break;
+  case UNUR_METH_HINV:
+    _Runuran_pack_hinv(gen, sexp_unur);
+    break;
+  case UNUR_METH_DGT:
+    _Runuran_pack_dgt(gen, sexp_unur);
+    break;
+  case UNUR_METH_DAU:
+    _Runuran_pack_dau(gen, sexp_unur);
+    break;
+  case UNUR_METH_TDR:
+    _Runuran_pack_tdr(gen, sexp_unur);
+    break;
 
   default:
     Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot pack UNU.RAN object");
   }
 
-  /* remove UNU.RAN object */
-  unur_free(gen);
-  R_ClearExternalPtr(sexp_gen);
+  /* remove UNU.RAN object (and its buffered URNG) */
+  _Runuran_free(sexp_gen);
 
   /* o.k. */
   return R_NilValue;
@@ -1123,6 +1342,29 @@ _Runuran_R_unif_rand (void *unused  ATTRIBUTE__UNUSED)
 
 /*---------------------------------------------------------------------------*/
 
+unsigned int
+_Runuran_R_unif_rand_array (void *unused  ATTRIBUTE__UNUSED, double *X, int n)
+     /*----------------------------------------------------------------------*/
+     /* Fill array with uniform random numbers from R built-in generator.    */
+     /* (Used for refilling the buffer of a buffered URNG.)                  */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unused ... argument required for UNU.RAN API                       */
+     /*   X      ... pointer to array of (at least) length 'n'               */
+     /*   n      ... number of uniform random numbers                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   number of uniform random numbers stored in 'X'                     */ 
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  for (i=0; i<n; i++)
+    X[i] = unif_rand();
+  return n;
+} /* end _Runuran_R_unif_rand_array() */
+
+/*---------------------------------------------------------------------------*/
+
 SEXP _Runuran_tag(void) 
      /*----------------------------------------------------------------------*/
      /* Make tag for R UNU.RAN generator object                              */
@@ -1232,3 +1474,249 @@ SEXP Runuran_set_aux_seed (SEXP sexp_seed)
 } /* end of Runuran_set_aux_seed() */
 
 /*---------------------------------------------------------------------------*/
+
+SEXP Runuran_use_urng_buffer (SEXP sexp_unur, SEXP sexp_set)
+     /*----------------------------------------------------------------------*/
+     /* check, set or unset buffered URNG for given generator object         */
+     /*                                                                      */
+     /* A buffered URNG fetches blocks of RUNURAN_URNG_BUFFER uniform random */
+     /* numbers from the R built-in generator and serves them from its       */
+     /* buffer. The URNG object is owned by the generator object and freed   */
+     /* together with it (see _Runuran_free()).                              */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur ... 'Runuran' generator object                                */ 
+     /*   set  ... whether we use a buffered URNG                            */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   old value of 'set'                                                 */ 
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_gen;                   /* S4 class containing generator object */
+  struct unur_gen *gen = NULL;     /* UNU.RAN generator object */
+  UNUR_URNG *urng;                 /* URNG of generator object */
+  int set;                         /* value which we have to set */
+  SEXP sexp_old = R_NilValue;      /* old value of set */
+  const char *class;               /* class name of 'unr' */ 
+
+  /* first argument must be S4 class */
+  if (!Rf_isS4(sexp_unur))
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN generator object");
+
+  /* we need a generator object */ 
+  class = Rf_translateChar(STRING_ELT( Rf_getAttrib(sexp_unur, R_ClassSymbol), 0));
+  if (strcmp(class,"unuran")) 
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN generator object");
+
+  /* extract pointer to UNU.RAN generator object */
+  sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+  if (! Rf_isNull(sexp_gen)) {
+    CHECK_UNUR_PTR(sexp_gen);
+    gen = R_ExternalPtrAddr(sexp_gen);
+  }
+  if (gen == NULL) {
+    Rf_error("[UNU.RAN - error] broken or packed UNU.RAN object");
+  }
+
+  /* read old value of 'set' */
+  urng = unur_get_urng(gen);
+  PROTECT(sexp_old = Rf_allocVector(LGLSXP, 1));
+  LOGICAL(sexp_old)[0] = (unur_urng_get_buffer_size(urng) > 0) ? TRUE : FALSE;
+
+  /* set new value */
+  if (! Rf_isNull(sexp_set)) {
+    set = LOGICAL(sexp_set)[0];
+    if (set != LOGICAL(sexp_old)[0]) {
+      if (set) {
+	/* create buffered URNG object for R built-in generator */
+	urng = unur_urng_new( _Runuran_R_unif_rand, NULL );
+	unur_urng_set_sample_array( urng, _Runuran_R_unif_rand_array );
+	unur_urng_set_buffer( urng, RUNURAN_URNG_BUFFER );
+	_Runuran_chg_urng(gen, urng);
+      }
+      else {
+	/* switch back to default URNG */
+	_Runuran_chg_urng(gen, unur_get_default_urng());
+      }
+    }
+  }
+
+  /* return old value of 'set' */
+  UNPROTECT(1);
+  return (sexp_old);
+
+} /* end of Runuran_use_urng_buffer() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_use_native_urng (SEXP sexp_unur, SEXP sexp_set)
+     /*----------------------------------------------------------------------*/
+     /* check, set or unset native URNG for given generator object           */
+     /*                                                                      */
+     /* A native URNG is a MRG31k3p generator that runs entirely in C.       */
+     /* It is seeded from the R built-in generator when it is created.       */
+     /* Sampling then does not touch the state of the R built-in generator.  */
+     /* The URNG object is owned by the generator object and freed together  */
+     /* with it (see _Runuran_free()).                                       */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur ... 'Runuran' generator object                                */ 
+     /*   set  ... whether we use a native URNG                              */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   old value of 'set'                                                 */ 
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_gen;                   /* S4 class containing generator object */
+  struct unur_gen *gen = NULL;     /* UNU.RAN generator object */
+  unsigned long seed;              /* seed for native URNG */
+  int set;                         /* value which we have to set */
+  SEXP sexp_old = R_NilValue;      /* old value of set */
+  const char *class;               /* class name of 'unr' */ 
+
+  /* first argument must be S4 class */
+  if (!Rf_isS4(sexp_unur))
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN generator object");
+
+  /* we need a generator object */ 
+  class = Rf_translateChar(STRING_ELT( Rf_getAttrib(sexp_unur, R_ClassSymbol), 0));
+  if (strcmp(class,"unuran")) 
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN generator object");
+
+  /* extract pointer to UNU.RAN generator object */
+  sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+  if (! Rf_isNull(sexp_gen)) {
+    CHECK_UNUR_PTR(sexp_gen);
+    gen = R_ExternalPtrAddr(sexp_gen);
+  }
+  if (gen == NULL) {
+    Rf_error("[UNU.RAN - error] broken or packed UNU.RAN object");
+  }
+
+  /* read old value of 'set' */
+  PROTECT(sexp_old = Rf_allocVector(LGLSXP, 1));
+  LOGICAL(sexp_old)[0] = _Runuran_has_native_urng(gen);
+
+  /* set new value */
+  if (! Rf_isNull(sexp_set)) {
+    set = LOGICAL(sexp_set)[0];
+    if (set != LOGICAL(sexp_old)[0]) {
+      if (set) {
+	/* draw seed from R built-in generator */
+	GetRNGstate();
+	seed = 1ul + (unsigned long) (2147462578. * unif_rand());
+	PutRNGstate();
+	/* create native URNG object */
+	_Runuran_chg_urng(gen, unur_urng_MRG31k3p_new(seed));
+      }
+      else {
+	/* switch back to default URNG */
+	_Runuran_chg_urng(gen, unur_get_default_urng());
+      }
+    }
+  }
+
+  /* return old value of 'set' */
+  UNPROTECT(1);
+  return (sexp_old);
+
+} /* end of Runuran_use_native_urng() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_set_native_seed (SEXP sexp_unur, SEXP sexp_seed)
+     /*----------------------------------------------------------------------*/
+     /* set seed for native URNG of given generator object                   */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur ... 'Runuran' generator object                                */ 
+     /*   seed ... seed for native URNG                                      */ 
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   NULL                                                               */ 
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_gen;                   /* S4 class containing generator object */
+  struct unur_gen *gen = NULL;     /* UNU.RAN generator object */
+  int seed;                        /* seed for native URNG */
+
+  /* first argument must be S4 class */
+  if (!Rf_isS4(sexp_unur))
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN generator object");
+
+  /* extract pointer to UNU.RAN generator object */
+  sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+  if (! Rf_isNull(sexp_gen)) {
+    CHECK_UNUR_PTR(sexp_gen);
+    gen = R_ExternalPtrAddr(sexp_gen);
+  }
+  if (gen == NULL) {
+    Rf_error("[UNU.RAN - error] broken or packed UNU.RAN object");
+  }
+
+  /* generator object must own a native URNG */
+  if (! _Runuran_has_native_urng(gen)) {
+    Rf_error("[UNU.RAN - error] generator object does not use native URNG");
+  }
+
+  seed = INTEGER(sexp_seed)[0];
+  if (seed == NA_INTEGER || seed <= 0) 
+    Rf_error("[UNU.RAN - error] seed is non-positive");
+  unur_urng_seed (unur_get_urng(gen), (unsigned long) seed);
+  return R_NilValue;
+
+} /* end of Runuran_set_native_seed() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_Runuran_has_native_urng (struct unur_gen *gen)
+     /*----------------------------------------------------------------------*/
+     /* check whether generator object uses a native URNG, i.e., it owns a   */
+     /* URNG object that does not draw from the R built-in generator.        */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen ... pointer to UNU.RAN generator object                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   TRUE if native URNG is used, FALSE otherwise                       */
+     /*----------------------------------------------------------------------*/
+{
+  UNUR_URNG *urng = unur_get_urng(gen);
+
+  /* a buffered URNG (with non-empty buffer) draws from R built-in URNG */
+  return ((urng != unur_get_default_urng() && unur_urng_get_buffer_size(urng) == 0)
+	  ? TRUE : FALSE);
+} /* end of _Runuran_has_native_urng() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_Runuran_chg_urng (struct unur_gen *gen, UNUR_URNG *urng)
+     /*----------------------------------------------------------------------*/
+     /* replace URNG of generator object.                                    */
+     /* A URNG owned by the generator object is freed.                       */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen  ... pointer to UNU.RAN generator object                       */
+     /*   urng ... new URNG object                                           */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   (void)                                                             */
+     /*----------------------------------------------------------------------*/
+{
+  UNUR_URNG *urng_old = unur_get_urng(gen);
+  int use_aux;
+
+  /* unur_chg_urng() also resets the auxiliary URNG */
+  use_aux = (unur_get_urng_aux(gen) != NULL && unur_get_urng_aux(gen) != urng_old);
+
+  unur_chg_urng(gen, urng);
+  if (urng_old != unur_get_default_urng())
+    unur_urng_free(urng_old);
+
+  if (use_aux)
+    unur_chgto_urng_aux_default(gen);
+} /* end of _Runuran_chg_urng() */
+
+/*---------------------------------------------------------------------------*/
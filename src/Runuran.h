@@ -53,7 +53,7 @@ SEXP Runuran_init (SEXP sexp_obj, SEXP sexp_distr, SEXP sexp_method);
 /* Create and initialize UNU.RAN generator object.                           */
 /*---------------------------------------------------------------------------*/
 
-SEXP Runuran_sample (SEXP sexp_unur, SEXP sexp_n);
+SEXP Runuran_sample (SEXP sexp_unur, SEXP sexp_n, SEXP sexp_threads);
 /*---------------------------------------------------------------------------*/
 /* Sample from UNU.RAN generator object.                                     */
 /*---------------------------------------------------------------------------*/
@@ -63,9 +63,65 @@ SEXP _Runuran_sample_unur (struct unur_gen *gen, int n);
 /* Sample from generator object: use UNU.RAN object                          */
 /*---------------------------------------------------------------------------*/
 
+#define RUNURAN_SAMPLE_BLOCK (4096)
+/*---------------------------------------------------------------------------*/
+/* Size of buffer for drawing random samples in blocks.                      */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_sample_unur_threads (struct unur_gen *gen, int n, int threads);
+/*---------------------------------------------------------------------------*/
+/* Sample from generator object: use UNU.RAN object and several threads      */
+/*---------------------------------------------------------------------------*/
+
+#define RUNURAN_THREAD_CHUNK (65536)
+/*---------------------------------------------------------------------------*/
+/* Number of random variates in each chunk of a multithreaded sample.        */
+/*---------------------------------------------------------------------------*/
+
 SEXP _Runuran_sample_data (SEXP sexp_data, int n);
 /*---------------------------------------------------------------------------*/
-/* Sample from generator object: use R data list (packed object)             */
+/* Sample from generator object: use tables of packed object                */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_sample_sorted (SEXP sexp_unur, SEXP sexp_n);
+/*---------------------------------------------------------------------------*/
+/* Draw sorted random sample from generator object (inversion methods).      */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_cache_sample (SEXP sexp_distr, SEXP sexp_method, SEXP sexp_n);
+/*---------------------------------------------------------------------------*/
+/* Sample from cached generator object for distribution and method strings. */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_cache_size (SEXP sexp_size);
+/*---------------------------------------------------------------------------*/
+/* Set maximal number of generator objects in cache.                         */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_cache_stats (SEXP sexp_reset);
+/*---------------------------------------------------------------------------*/
+/* Get statistics about cache of generator objects.                          */
+/*---------------------------------------------------------------------------*/
+
+void _Runuran_cache_free (void);
+/*---------------------------------------------------------------------------*/
+/* Free all generator objects in cache.                                      */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_sample_params (SEXP sexp_name, SEXP sexp_params);
+/*---------------------------------------------------------------------------*/
+/* Sample from special distribution with one parameter set per draw.         */
+/*---------------------------------------------------------------------------*/
+
+#define RUNURAN_CACHE_SIZE (256)
+/*---------------------------------------------------------------------------*/
+/* Default for maximal number of generator objects in cache.                 */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_benchmark (SEXP sexp_distr, SEXP sexp_method, SEXP sexp_n, SEXP sexp_nq);
+/*---------------------------------------------------------------------------*/
+/* Measure setup time, marginal generation times and memory footprint of    */
+/* generator object for distribution and method strings.                     */
 /*---------------------------------------------------------------------------*/
 
 SEXP Runuran_quantile (SEXP sexp_unur, SEXP sexp_U);
@@ -80,7 +136,7 @@ SEXP _Runuran_quantile_unur (struct unur_gen *gen, SEXP sexp_U);
 
 SEXP _Runuran_quantile_data (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur);
 /*---------------------------------------------------------------------------*/
-/* Evaluate approximate quantile function:  use R data list (packed object)  */
+/* Evaluate approximate quantile function:  use tables of packed object     */
 /*---------------------------------------------------------------------------*/
 
 SEXP Runuran_PDF (SEXP sexp_obj, SEXP sexp_x, SEXP sexp_islog);
@@ -108,6 +164,21 @@ SEXP Runuran_performance (SEXP sexp_unur, SEXP sexp_debug);
 /* Get some informations about UNU.RAN generator object in an R list.        */
 /*---------------------------------------------------------------------------*/
 
+SEXP Runuran_counters (SEXP sexp_unur, SEXP sexp_count, SEXP sexp_reset);
+/*---------------------------------------------------------------------------*/
+/* Switch on/off, read and reset counters of UNU.RAN generator object.       */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_setup (SEXP sexp_unur);
+/*---------------------------------------------------------------------------*/
+/* Get timings and PDF/CDF evaluations of setup phases of generator object.  */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_set_profiling (SEXP sexp_profile);
+/*---------------------------------------------------------------------------*/
+/* Switch recording of setup profile of new generator objects on/off.        */
+/*---------------------------------------------------------------------------*/
+
 SEXP Runuran_verify_hat (SEXP sexp_unur, SEXP sexp_n);
 /*---------------------------------------------------------------------------*/
 /* Verify hat of UNU.RAN generator object that implements rejection method.  */
@@ -122,7 +193,8 @@ SEXP Runuran_set_error_level (SEXP sexp_level);
 /*****************************************************************************/
 /* Meta methods                                                              */
 
-SEXP Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion);
+SEXP Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion,
+		   SEXP sexp_grouped);
 /*---------------------------------------------------------------------------*/
 /* Create UNU.RAN generator object for mixture of distribution.              */
 /*---------------------------------------------------------------------------*/
@@ -132,6 +204,7 @@ SEXP Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inve
 
 SEXP Runuran_cont_init (SEXP sexp_obj, SEXP sexp_env, 
 			SEXP sexp_cdf, SEXP sexp_pdf, SEXP sexp_dpdf, SEXP sexp_islog,
+			SEXP sexp_vectorized,
 			SEXP sexp_mode, SEXP sexp_center, SEXP sexp_domain, 
 			SEXP sexp_area, SEXP sexp_name);
 /*---------------------------------------------------------------------------*/
@@ -154,6 +227,11 @@ SEXP Runuran_cmv_init (SEXP sexp_obj, SEXP sexp_env,
 /* Create and initialize UNU.RAN object for cont. multivariate distribution. */
 /*---------------------------------------------------------------------------*/
 
+SEXP _Runuran_cont_get_pdf (const struct unur_distr *distr, int *islog);
+/*---------------------------------------------------------------------------*/
+/* Get PDF (or logPDF) of continuous distribution as R function.             */
+/*---------------------------------------------------------------------------*/
+
 
 SEXP Runuran_std_cont (SEXP sexp_obj, SEXP sexp_name, SEXP sexp_params, SEXP sexp_domain);
 /*---------------------------------------------------------------------------*/
@@ -175,6 +253,11 @@ UNUR_DISTR *_Runuran_get_std_discr( const char *name, const double *params, int
 /* Create UNU.RAN object for distribution 'name'.                            */
 /*---------------------------------------------------------------------------*/
 
+SEXP Runuran_std_cmv (SEXP sexp_obj, SEXP sexp_name, SEXP sexp_mean, SEXP sexp_covar);
+/*---------------------------------------------------------------------------*/
+/* Create UNU.RAN object for special multivariate distribution.              */
+/*---------------------------------------------------------------------------*/
+
 /*****************************************************************************/
 /*                                                                           */
 /*   Internal functions (not used by .Call from R)                           */
@@ -268,19 +351,126 @@ SEXP _Runuran_distr_tag(void);
 /*****************************************************************************/
 /* Special packing functions                                                 */
 
+/* Tables of a packed generator object.                                      */
+/* They are either stored in the R data list in slot 'data' of the 'unuran'  */
+/* object or in a table file that is mapped into memory (Runuran_table.c).   */
+
+#define RUNURAN_PACKED_MAX_SLOTS (16)
+
+struct Runuran_packed {
+  int n_slots;                                  /* number of tables          */
+  const void *table[RUNURAN_PACKED_MAX_SLOTS];  /* pointers to tables        */
+  int length[RUNURAN_PACKED_MAX_SLOTS];         /* lengths of tables         */
+  double dom[2];                                /* domain of distribution    */
+  SEXP list;                                    /* R data list (if any)      */
+};
+
+#define PACKED_INT(data,p)     ((const int *) ((data)->table[(p)]))
+#define PACKED_REAL(data,p)    ((const double *) ((data)->table[(p)]))
+#define PACKED_LENGTH(data,p)  ((data)->length[(p)])
+
+void _Runuran_get_packed (struct Runuran_packed *packed, SEXP sexp_data, SEXP sexp_dom);
+/*---------------------------------------------------------------------------*/
+/* Get tables of packed generator object from R data list or mapped file.    */
+/*---------------------------------------------------------------------------*/
+
 void _Runuran_pack_pinv (struct unur_gen *gen, SEXP sexp_unur);
 /*---------------------------------------------------------------------------*/
 /* Pack Runuran generator object for method PINV into R list                 */
 /*---------------------------------------------------------------------------*/
 
-SEXP _Runuran_sample_pinv (SEXP sexp_data, int n);
+SEXP _Runuran_sample_pinv (const struct Runuran_packed *data, int n);
+/*---------------------------------------------------------------------------*/
+/* Sample from generator object: use tables of packed object                 */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_quantile_pinv (const struct Runuran_packed *data, SEXP sexp_U);
+/*---------------------------------------------------------------------------*/
+/* Evaluate approximate quantile function:  use tables of packed object      */
+/*---------------------------------------------------------------------------*/
+
+void _Runuran_pack_hinv (struct unur_gen *gen, SEXP sexp_unur);
+/*---------------------------------------------------------------------------*/
+/* Pack Runuran generator object for method HINV into R list                 */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_sample_hinv (const struct Runuran_packed *data, int n);
+/*---------------------------------------------------------------------------*/
+/* Sample from generator object: use tables of packed object                 */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_quantile_hinv (const struct Runuran_packed *data, SEXP sexp_U);
 /*---------------------------------------------------------------------------*/
-/* Sample from generator object: use R data list (packed object)             */
+/* Evaluate approximate quantile function:  use tables of packed object      */
 /*---------------------------------------------------------------------------*/
 
-SEXP _Runuran_quantile_pinv (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur);
+void _Runuran_pack_dgt (struct unur_gen *gen, SEXP sexp_unur);
 /*---------------------------------------------------------------------------*/
-/* Evaluate approximate quantile function:  use R data list (packed object)  */
+/* Pack Runuran generator object for method DGT into R list                  */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_sample_dgt (const struct Runuran_packed *data, int n);
+/*---------------------------------------------------------------------------*/
+/* Sample from generator object: use tables of packed object                 */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_quantile_dgt (const struct Runuran_packed *data, SEXP sexp_U);
+/*---------------------------------------------------------------------------*/
+/* Evaluate quantile function:  use tables of packed object                  */
+/*---------------------------------------------------------------------------*/
+
+void _Runuran_pack_dau (struct unur_gen *gen, SEXP sexp_unur);
+/*---------------------------------------------------------------------------*/
+/* Pack Runuran generator object for method DAU into R list                  */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_sample_dau (const struct Runuran_packed *data, int n);
+/*---------------------------------------------------------------------------*/
+/* Sample from generator object: use tables of packed object                 */
+/*---------------------------------------------------------------------------*/
+
+void _Runuran_pack_tdr (struct unur_gen *gen, SEXP sexp_unur);
+/*---------------------------------------------------------------------------*/
+/* Pack Runuran generator object for method TDR into R list                  */
+/*---------------------------------------------------------------------------*/
+
+SEXP _Runuran_sample_tdr (const struct Runuran_packed *data, int n);
+/*---------------------------------------------------------------------------*/
+/* Sample from generator object: use tables of packed object                 */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_tdr_frozen (SEXP sexp_unur, SEXP sexp_op, SEXP sexp_n);
+/*---------------------------------------------------------------------------*/
+/* Internal function for testing the frozen hat of method TDR.               */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_fstr_eval (SEXP sexp_fstr, SEXP sexp_x, SEXP sexp_op);
+/*---------------------------------------------------------------------------*/
+/* Internal function for testing the function parser.                        */
+/*---------------------------------------------------------------------------*/
+
+
+/*****************************************************************************/
+/* Table files                                                               */
+
+SEXP Runuran_table_save (SEXP sexp_unur, SEXP sexp_file);
+/*---------------------------------------------------------------------------*/
+/* Write tables of generator object into binary table file.                  */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_table_load (SEXP sexp_unur, SEXP sexp_file);
+/*---------------------------------------------------------------------------*/
+/* Map binary table file into memory and store it in 'unuran' object.        */
+/*---------------------------------------------------------------------------*/
+
+int _Runuran_table_is_mapped (SEXP sexp_data);
+/*---------------------------------------------------------------------------*/
+/* Check whether data list of packed object refers to a mapped table file.   */
+/*---------------------------------------------------------------------------*/
+
+void _Runuran_table_get (struct Runuran_packed *data, SEXP sexp_data);
+/*---------------------------------------------------------------------------*/
+/* Get tables of packed generator object from mapped table file.             */
 /*---------------------------------------------------------------------------*/
 
 
@@ -302,5 +492,45 @@ double _Runuran_R_unif_rand (void *unused);
 /* Wrapper for R built-in uniform random number generator.                   */
 /*---------------------------------------------------------------------------*/
 
+unsigned int _Runuran_R_unif_rand_array (void *unused, double *X, int n);
+/*---------------------------------------------------------------------------*/
+/* Fill array with uniform random numbers from R built-in generator.         */
+/*---------------------------------------------------------------------------*/
+
+
+/*****************************************************************************/
+/* Buffered URNG                                                             */
+
+#define RUNURAN_URNG_BUFFER (1024)
+/*---------------------------------------------------------------------------*/
+/* Number of uniform random numbers that are fetched at once from the R      */
+/* built-in generator when the URNG of a generator object is buffered.       */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_use_urng_buffer (SEXP sexp_unur, SEXP sexp_set);
+/*---------------------------------------------------------------------------*/
+/* check, set or unset buffered URNG for given generator object.             */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_use_native_urng (SEXP sexp_unur, SEXP sexp_set);
+/*---------------------------------------------------------------------------*/
+/* check, set or unset native URNG for given generator object.               */
+/*---------------------------------------------------------------------------*/
+
+SEXP Runuran_set_native_seed (SEXP sexp_unur, SEXP sexp_seed);
+/*---------------------------------------------------------------------------*/
+/* set seed for native URNG of given generator object.                       */
+/*---------------------------------------------------------------------------*/
+
+int _Runuran_has_native_urng (struct unur_gen *gen);
+/*---------------------------------------------------------------------------*/
+/* check whether generator object uses a native URNG.                        */
+/*---------------------------------------------------------------------------*/
+
+void _Runuran_chg_urng (struct unur_gen *gen, UNUR_URNG *urng);
+/*---------------------------------------------------------------------------*/
+/* replace (and free) URNG owned by generator object.                        */
+/*---------------------------------------------------------------------------*/
+
 
 /*****************************************************************************/
@@ -0,0 +1,215 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_bench.c                                                   *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         Benchmark UNU.RAN generator objects.                              *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   The generator object is created from a distribution string and a       *
+ *   method string (see unur_makegen_ssu()). We measure                      *
+ *                                                                           *
+ *     setup    ... time for creating the generator object [seconds]        *
+ *     sample   ... marginal generation time [nanoseconds per variate]      *
+ *     quantile ... time for evaluating the approximate quantile function   *
+ *                  [nanoseconds per call] (inversion methods only)          *
+ *     memory   ... number of bytes allocated by UNU.RAN for a copy of the  *
+ *                  generator object after sampling                          *
+ *                                                                           *
+ *   The memory footprint is obtained by counting the bytes requested       *
+ *   by _unur_xmalloc() and _unur_xrealloc() while the generator object     *
+ *   is cloned.                                                              *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+
+#include <time.h>
+
+/*---------------------------------------------------------------------------*/
+
+static double _Runuran_bench_clock (void);
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_benchmark (SEXP sexp_distr, SEXP sexp_method, SEXP sexp_n, SEXP sexp_nq)
+     /*----------------------------------------------------------------------*/
+     /* Measure setup time, marginal generation times and memory footprint  */
+     /* of generator object for given distribution and method strings.       */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   distr  ... distribution (string)                                   */
+     /*   method ... method (string)                                         */
+     /*   n      ... sample size (positive integer)                          */
+     /*   nq     ... number of evaluations of quantile function              */
+     /*              (non-negative integer)                                  */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   named numeric vector with entries 'setup', 'sample', 'quantile'    */
+     /*   and 'memory' (NA if not available);                                */
+     /*   NULL if the generator object cannot be created                     */
+     /*----------------------------------------------------------------------*/
+{
+  const char *distr;
+  const char *method;
+  int n, nq;
+  struct unur_gen *gen;
+  struct unur_gen *clone;
+  double *X, *U;
+  int *K;
+  size_t bytes;
+  int old_level;
+  double t0, t1;
+  double *res;
+  SEXP sexp_res, sexp_names;
+  int i;
+
+  /* check arguments */
+  if (TYPEOF(sexp_distr) != STRSXP || TYPEOF(sexp_method) != STRSXP)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'distribution' or 'method'");
+  distr = CHAR(STRING_ELT(sexp_distr,0));
+  method = CHAR(STRING_ELT(sexp_method,0));
+
+  n = *(INTEGER (Rf_coerceVector(sexp_n, INTSXP)));
+  if (n<=0) {
+    Rf_error("sample size 'n' must be positive integer");
+  }
+  nq = *(INTEGER (Rf_coerceVector(sexp_nq, INTSXP)));
+  if (nq<0) {
+    Rf_error("argument 'nq' must be non-negative integer");
+  }
+
+  /* allocate memory for result */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, 4));
+  res = REAL(sexp_res);
+  for (i=0; i<4; i++) res[i] = NA_REAL;
+  PROTECT(sexp_names = Rf_allocVector(STRSXP, 4));
+  SET_STRING_ELT(sexp_names, 0, Rf_mkChar("setup"));
+  SET_STRING_ELT(sexp_names, 1, Rf_mkChar("sample"));
+  SET_STRING_ELT(sexp_names, 2, Rf_mkChar("quantile"));
+  SET_STRING_ELT(sexp_names, 3, Rf_mkChar("memory"));
+  Rf_setAttrib(sexp_res, R_NamesSymbol, sexp_names);
+
+  /* create generator object (suppress messages for invalid combinations) */
+  old_level = _Runuran_set_error_handler(0);
+  t0 = _Runuran_bench_clock();
+  gen = unur_makegen_ssu( distr, method, NULL );
+  t1 = _Runuran_bench_clock();
+  _Runuran_set_error_handler(old_level);
+  if (gen == NULL) {
+    UNPROTECT(2);
+    return R_NilValue;
+  }
+  res[0] = t1 - t0;
+
+  /* marginal generation time */
+  GetRNGstate();
+  switch (unur_distr_get_type(unur_get_distr(gen))) {
+  case UNUR_DISTR_CONT:
+  case UNUR_DISTR_CEMP:
+    X = (double *) R_alloc(n, sizeof(double));
+    t0 = _Runuran_bench_clock();
+    unur_sample_cont_array(gen, X, n);
+    t1 = _Runuran_bench_clock();
+    res[1] = 1.e9 * (t1 - t0) / n;
+    break;
+  case UNUR_DISTR_DISCR:
+    K = (int *) R_alloc(n, sizeof(int));
+    t0 = _Runuran_bench_clock();
+    unur_sample_discr_array(gen, K, n);
+    t1 = _Runuran_bench_clock();
+    res[1] = 1.e9 * (t1 - t0) / n;
+    break;
+  default:
+    /* multivariate distributions are not supported */
+    break;
+  }
+  PutRNGstate();
+
+  /* evaluation of quantile function */
+  if (nq > 0 && unur_gen_is_inversion(gen)) {
+    U = (double *) R_alloc(nq, sizeof(double));
+    X = (double *) R_alloc(nq, sizeof(double));
+    /* use random arguments: for sorted arguments unur_quantile_array() */
+    /* walks through the tables which is much faster                    */
+    GetRNGstate();
+    for (i=0; i<nq; i++)
+      U[i] = unif_rand();
+    PutRNGstate();
+    old_level = _Runuran_set_error_handler(0);
+    t0 = _Runuran_bench_clock();
+    if (unur_quantile_array(gen, U, X, nq) == UNUR_SUCCESS) {
+      t1 = _Runuran_bench_clock();
+      res[2] = 1.e9 * (t1 - t0) / nq;
+    }
+    _Runuran_set_error_handler(old_level);
+  }
+
+  /* memory footprint */
+  bytes = 0;
+  _unur_xmalloc_set_counter(&bytes);
+  clone = unur_gen_clone(gen);
+  _unur_xmalloc_set_counter(NULL);
+  if (clone != NULL) {
+    res[3] = (double) bytes;
+    unur_free(clone);
+  }
+
+  /* clear memory */
+  unur_free(gen);
+
+  /* return result to R */
+  UNPROTECT(2);
+  return sexp_res;
+
+} /* end of Runuran_benchmark() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_Runuran_bench_clock (void)
+     /*----------------------------------------------------------------------*/
+     /* Wall clock time in seconds (monotonic if available).                 */
+     /*----------------------------------------------------------------------*/
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1.e-9 * ts.tv_nsec;
+#else
+  return ((double) clock()) / CLOCKS_PER_SEC;
+#endif
+} /* end of _Runuran_bench_clock() */
+
+/*---------------------------------------------------------------------------*/
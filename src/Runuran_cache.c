@@ -0,0 +1,371 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_cache.c                                                   *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         Cache for UNU.RAN generator objects created from strings.         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   The convenience functions ur...() (e.g. urgamma()) create a generator   *
+ *   object from a distribution string and a method string. The generator   *
+ *   objects are kept in a cache with least-recently-used replacement.      *
+ *   The key is the concatenation of both strings with all white space      *
+ *   removed.                                                                *
+ *                                                                           *
+ *   Methods that change their tables during sampling (e.g. TDR) sample     *
+ *   from a clone of the cached object. Thus the sample is the same as      *
+ *   for a freshly created generator object.                                 *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+
+#include <ctype.h>
+
+/*---------------------------------------------------------------------------*/
+
+/* entry in cache */
+struct Runuran_cache_entry {
+  char *key;                 /* canonical distribution + method string */
+  unsigned long hash;        /* hash value of key */
+  struct unur_gen *gen;      /* generator object */
+  unsigned long stamp;       /* time of last usage */
+};
+
+static struct Runuran_cache_entry *cache = NULL;   /* table of entries */
+static int cache_n = 0;                   /* number of entries */
+static int cache_max = RUNURAN_CACHE_SIZE; /* maximal number of entries */
+static unsigned long cache_clock = 0ul;   /* counter for LRU replacement */
+
+/* statistics */
+static double cache_hits = 0.;
+static double cache_misses = 0.;
+static double cache_evictions = 0.;
+
+/*---------------------------------------------------------------------------*/
+
+static char *_Runuran_cache_key (const char *distr, const char *method, unsigned long *hash);
+static void _Runuran_cache_evict (int n_max);
+static int _Runuran_cache_is_adaptive (const struct unur_gen *gen);
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_cache_sample (SEXP sexp_distr, SEXP sexp_method, SEXP sexp_n)
+     /*----------------------------------------------------------------------*/
+     /* Sample from cached generator object for given distribution and       */
+     /* method strings. The generator object is created if it is not found  */
+     /* in the cache.                                                        */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   distr  ... distribution (string)                                   */
+     /*   method ... method (string)                                         */
+     /*   n      ... sample size (positive integer)                          */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   random sample of size 'n'                                          */
+     /*----------------------------------------------------------------------*/
+{
+  const char *distr;
+  const char *method;
+  int n;
+  char *key;
+  unsigned long hash;
+  struct unur_gen *gen = NULL;
+  struct unur_gen *clone;
+  SEXP sexp_res;
+  int i;
+
+  /* check arguments */
+  if (TYPEOF(sexp_distr) != STRSXP || TYPEOF(sexp_method) != STRSXP)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'distribution' or 'method'");
+  distr = CHAR(STRING_ELT(sexp_distr,0));
+  method = CHAR(STRING_ELT(sexp_method,0));
+
+  /* Extract and check sample size */
+  n = *(INTEGER (Rf_coerceVector(sexp_n, INTSXP)));
+  if (n<=0) {
+    Rf_error("sample size 'n' must be positive integer");
+  }
+
+  /* lookup generator object in cache */
+  key = _Runuran_cache_key(distr, method, &hash);
+  for (i=0; i<cache_n; i++) {
+    if (cache[i].hash == hash && !strcmp(cache[i].key, key)) {
+      gen = cache[i].gen;
+      cache[i].stamp = ++cache_clock;
+      cache_hits += 1.;
+      break;
+    }
+  }
+
+  /* create generator object */
+  if (gen == NULL) {
+    cache_misses += 1.;
+    gen = unur_makegen_ssu( distr, method, NULL );
+    if (gen == NULL) {
+      Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot create UNU.RAN object");
+    }
+    if (cache_max > 0) {
+      /* insert into cache */
+      if (cache == NULL)
+	cache = malloc(cache_max * sizeof(struct Runuran_cache_entry));
+      if (cache == NULL) {
+	unur_free(gen);
+	Rf_error("[UNU.RAN - error] cannot allocate memory for cache");
+      }
+      _Runuran_cache_evict(cache_max - 1);
+      cache[cache_n].key = malloc(strlen(key)+1);
+      if (cache[cache_n].key == NULL) {
+	unur_free(gen);
+	Rf_error("[UNU.RAN - error] cannot allocate memory for cache");
+      }
+      strcpy(cache[cache_n].key, key);
+      cache[cache_n].hash = hash;
+      cache[cache_n].gen = gen;
+      cache[cache_n].stamp = ++cache_clock;
+      ++cache_n;
+    }
+    else {
+      /* no cache: use generator object only once */
+      PROTECT(sexp_res = _Runuran_sample_unur(gen, n));
+      unur_free(gen);
+      UNPROTECT(1);
+      return sexp_res;
+    }
+  }
+
+  /* sample */
+  if (_Runuran_cache_is_adaptive(gen)) {
+    clone = unur_gen_clone(gen);
+    if (clone == NULL)
+      Rf_error("[UNU.RAN - error] cannot clone UNU.RAN object");
+    PROTECT(sexp_res = _Runuran_sample_unur(clone, n));
+    unur_free(clone);
+    UNPROTECT(1);
+    return sexp_res;
+  }
+  else {
+    return _Runuran_sample_unur(gen, n);
+  }
+
+} /* end of Runuran_cache_sample() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_cache_size (SEXP sexp_size)
+     /*----------------------------------------------------------------------*/
+     /* Set maximal number of generator objects in cache.                    */
+     /* Size 0 disables the cache.                                           */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   size ... maximal number of entries (non-negative integer)          */
+     /*            or NULL                                                   */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   old value of size                                                  */
+     /*----------------------------------------------------------------------*/
+{
+  int size;
+  int old_size = cache_max;
+  struct Runuran_cache_entry *new_cache;
+
+  if (! Rf_isNull(sexp_size)) {
+    size = *(INTEGER (Rf_coerceVector(sexp_size, INTSXP)));
+    if (size == NA_INTEGER || size < 0)
+      Rf_error("[UNU.RAN - error] cache size must be non-negative integer");
+
+    /* remove entries that do not fit into new cache */
+    _Runuran_cache_evict(size);
+    if (size == 0) {
+      free(cache);
+      cache = NULL;
+    }
+    else if (cache != NULL) {
+      new_cache = realloc(cache, size * sizeof(struct Runuran_cache_entry));
+      if (new_cache == NULL)
+	Rf_error("[UNU.RAN - error] cannot allocate memory for cache");
+      cache = new_cache;
+    }
+    cache_max = size;
+  }
+
+  return Rf_ScalarInteger(old_size);
+
+} /* end of Runuran_cache_size() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_cache_stats (SEXP sexp_reset)
+     /*----------------------------------------------------------------------*/
+     /* Get statistics about cache of generator objects.                     */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   reset ... whether counters should be reset to 0 (boolean)          */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   R list with number of entries, maximal size, hits, misses,        */
+     /*   and evictions                                                      */
+     /*----------------------------------------------------------------------*/
+{
+#define n_stats (5)
+  static const char *stats_name[n_stats] = {"size","max.size","hits","misses","evictions"};
+  SEXP sexp_stats, sexp_names;
+  int i;
+
+  PROTECT(sexp_stats = Rf_allocVector(VECSXP, n_stats));
+  SET_VECTOR_ELT(sexp_stats, 0, Rf_ScalarInteger(cache_n));
+  SET_VECTOR_ELT(sexp_stats, 1, Rf_ScalarInteger(cache_max));
+  SET_VECTOR_ELT(sexp_stats, 2, Rf_ScalarReal(cache_hits));
+  SET_VECTOR_ELT(sexp_stats, 3, Rf_ScalarReal(cache_misses));
+  SET_VECTOR_ELT(sexp_stats, 4, Rf_ScalarReal(cache_evictions));
+
+  PROTECT(sexp_names = Rf_allocVector(STRSXP, n_stats));
+  for (i=0; i<n_stats; i++)
+    SET_STRING_ELT(sexp_names, i, Rf_mkChar(stats_name[i]));
+  Rf_setAttrib(sexp_stats, R_NamesSymbol, sexp_names);
+
+  if (*LOGICAL(Rf_coerceVector(sexp_reset, LGLSXP))) {
+    cache_hits = cache_misses = cache_evictions = 0.;
+  }
+
+  UNPROTECT(2);
+  return sexp_stats;
+#undef n_stats
+} /* end of Runuran_cache_stats() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_Runuran_cache_free (void)
+     /*----------------------------------------------------------------------*/
+     /* Free all generator objects in cache.                                 */
+     /*----------------------------------------------------------------------*/
+{
+  _Runuran_cache_evict(0);
+  free(cache);
+  cache = NULL;
+} /* end of _Runuran_cache_free() */
+
+/*---------------------------------------------------------------------------*/
+
+char *
+_Runuran_cache_key (const char *distr, const char *method, unsigned long *hash)
+     /*----------------------------------------------------------------------*/
+     /* Make canonical key for cache and compute its (FNV-1a) hash value.   */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   distr  ... distribution (string)                                   */
+     /*   method ... method (string)                                         */
+     /*   hash   ... pointer for storing hash value                          */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   key (allocated by R_alloc)                                         */
+     /*----------------------------------------------------------------------*/
+{
+  char *key, *k;
+  const char *s;
+  unsigned long h = 2166136261ul;
+
+  key = R_alloc(strlen(distr) + strlen(method) + 2, sizeof(char));
+  k = key;
+  for (s = distr; *s; s++)
+    if (!isspace((unsigned char) *s)) *k++ = *s;
+  *k++ = '&';
+  for (s = method; *s; s++)
+    if (!isspace((unsigned char) *s)) *k++ = *s;
+  *k = '\0';
+
+  for (k = key; *k; k++) {
+    h ^= (unsigned char) *k;
+    h = (h * 16777619ul) & 0xfffffffful;
+  }
+  *hash = h;
+
+  return key;
+} /* end of _Runuran_cache_key() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_Runuran_cache_evict (int n_max)
+     /*----------------------------------------------------------------------*/
+     /* Remove least recently used entries until at most 'n_max' entries    */
+     /* remain in cache.                                                     */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   n_max ... maximal number of remaining entries                      */
+     /*----------------------------------------------------------------------*/
+{
+  int i, i_lru;
+
+  while (cache_n > 0 && cache_n > n_max) {
+    /* find least recently used entry */
+    for (i_lru=0, i=1; i<cache_n; i++)
+      if (cache[i].stamp < cache[i_lru].stamp) i_lru = i;
+    /* remove entry */
+    unur_free(cache[i_lru].gen);
+    free(cache[i_lru].key);
+    cache[i_lru] = cache[--cache_n];
+    cache_evictions += 1.;
+  }
+} /* end of _Runuran_cache_evict() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_Runuran_cache_is_adaptive (const struct unur_gen *gen)
+     /*----------------------------------------------------------------------*/
+     /* Check whether method changes its tables during sampling.             */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen ... pointer to UNU.RAN generator object                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   TRUE if adaptive, FALSE otherwise                                  */
+     /*----------------------------------------------------------------------*/
+{
+  switch (gen->method) {
+  case UNUR_METH_AROU:
+  case UNUR_METH_ARS:
+  case UNUR_METH_TABL:
+  case UNUR_METH_TDR:
+    return TRUE;
+  default:
+    return FALSE;
+  }
+} /* end of _Runuran_cache_is_adaptive() */
+
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,193 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_dau.c                                                    *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         R interface for UNU.RAN -- DAU                                   *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+#include <methods/dau_struct.h>
+
+/*---------------------------------------------------------------------------*/
+
+/* number of entries (slots) in data list */
+#define n_slots (5)
+
+/* names of slots */
+static const char *slot_name[n_slots] = {"mid","lb","len","qx","jx"};
+
+/* positions in data list */
+enum {
+  pmid = 0,      /* method ID [ This MUST be 0 ! ] */
+  plb = 1,       /* left boundary of domain */
+  plen = 2,      /* length of probability vector */
+  pqx = 3,       /* cut points of urn */
+  pjx = 4        /* aliases of urn */
+};
+
+/*---------------------------------------------------------------------------*/
+
+#define GEN    ((struct unur_dau_gen*)gen->datap)
+/* data for generator object */
+
+#define DISTR  (gen->distr->data.discr)
+/* data for distribution in generator object */
+
+/*****************************************************************************/
+
+void
+_Runuran_pack_dau (struct unur_gen *gen, SEXP sexp_unur)
+     /*----------------------------------------------------------------------*/
+     /* Pack Runuran generator object for method DAU into R list             */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen  ... pointer to UNU.RAN generator object                       */
+     /*   unur ... 'Runuran' object (S4 class)                               */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  /* names of list entries */
+  SEXP sexp_data_names;
+
+  /* data list and its entries */
+  SEXP sexp_data, sexp_dom;
+  SEXP sexp_mid, sexp_lb, sexp_len, sexp_qx, sexp_jx;
+
+  /* create entries for data list */
+
+  /* method ID (int) */
+  PROTECT(sexp_mid = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_mid)[0] = UNUR_METH_DAU;
+
+  /* left boundary of domain (int) */
+  PROTECT(sexp_lb = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_lb)[0] = DISTR.domain[0];
+
+  /* length of probability vector (int) */
+  PROTECT(sexp_len = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_len)[0] = GEN->len;
+
+  /* cut points (double[]) */
+  PROTECT(sexp_qx = Rf_allocVector(REALSXP, GEN->urn_size));
+  memcpy(REAL(sexp_qx), GEN->qx, GEN->urn_size * sizeof(double));
+
+  /* aliases (int[]) */
+  PROTECT(sexp_jx = Rf_allocVector(INTSXP, GEN->urn_size));
+  memcpy(INTEGER(sexp_jx), GEN->jx, GEN->urn_size * sizeof(int));
+
+  /* list of "names" attribute of the objects in our list */
+  PROTECT(sexp_data_names = Rf_allocVector(STRSXP, n_slots));
+  for (i=0; i<n_slots; i++)
+    SET_STRING_ELT(sexp_data_names, i, Rf_mkChar(slot_name[i]));
+
+  /* create data list */
+  PROTECT(sexp_data = Rf_allocVector(VECSXP, n_slots));
+  SET_VECTOR_ELT(sexp_data, pmid, sexp_mid);      /* attach 'mid' element */
+  SET_VECTOR_ELT(sexp_data, plb,  sexp_lb);       /* attach 'lb' element  */
+  SET_VECTOR_ELT(sexp_data, plen, sexp_len);      /* attach 'len' element */
+  SET_VECTOR_ELT(sexp_data, pqx,  sexp_qx);       /* attach 'qx' element  */
+  SET_VECTOR_ELT(sexp_data, pjx,  sexp_jx);       /* attach 'jx' element  */
+
+  /* attach vector names */
+  Rf_setAttrib(sexp_data, R_NamesSymbol, sexp_data_names);
+
+  /* store in slot 'data' of S4 object 'unur' */
+  R_do_slot_assign(sexp_unur, Rf_install("data"), sexp_data);
+
+  /* set domain of distribution and store in slot 'dom' */
+  PROTECT(sexp_dom = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_dom)[0] = (double) DISTR.domain[0];
+  REAL(sexp_dom)[1] = (double) DISTR.domain[1];
+  R_do_slot_assign(sexp_unur, Rf_install("dom"), sexp_dom);
+
+  /* o.k. */
+  UNPROTECT(8);
+  return;
+
+} /* end of _Runuran_pack_dau() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_sample_dau (const struct Runuran_packed *data, int n)
+     /*----------------------------------------------------------------------*/
+     /* Sample from generator object: use R data list (packed object)        */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   data ... tables of packed generator object                         */
+     /*   n    ... sample size (positive integer)                            */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   random sample of size 'n'                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int i, iu;
+  double u;
+  double *res;
+  SEXP sexp_res = R_NilValue;
+
+  /* extract data */
+  int lb = PACKED_INT(data, plb)[0];
+  int len = PACKED_INT(data, plen)[0];
+  const double *qx = PACKED_REAL(data, pqx);
+  const int *jx = PACKED_INT(data, pjx);
+  int urn_size = PACKED_LENGTH(data, pqx);
+
+  /* generate sample */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+  for (i=0; i<n; i++) {
+    /* FIXME: R built-in URNG hard coded ! */
+    u = unif_rand() * urn_size;
+    iu = (int) u;
+
+    if (iu >= len)
+      /* right of the last entry: always use alias */
+      res[i] = (double) (jx[iu] + lb);
+    else {
+      /* else: reuse the fractional part of u */
+      u -= iu;
+      res[i] = (double) (((u <= qx[iu]) ? iu : jx[iu]) + lb);
+    }
+  }
+
+  /* return result to R */
+  UNPROTECT(1);
+  return sexp_res;
+
+} /* end of _Runuran_sample_dau() */
+
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,278 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_dgt.c                                                    *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         R interface for UNU.RAN -- DGT                                   *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+#include <methods/dgt_struct.h>
+
+/*---------------------------------------------------------------------------*/
+
+/* number of entries (slots) in data list */
+#define n_slots (5)
+
+/* names of slots */
+static const char *slot_name[n_slots] = {"mid","lb","sum","guide","cumpv"};
+
+/* positions in data list */
+enum {
+  pmid = 0,      /* method ID [ This MUST be 0 ! ] */
+  plb = 1,       /* left boundary of domain */
+  psum = 2,      /* sum over all probabilities */
+  pguide = 3,    /* guide table */
+  pcumpv = 4     /* cumulated probabilities */
+};
+
+/*---------------------------------------------------------------------------*/
+
+static int _dgt_eval (double U, double sum, int guide_size, const int *guide, const double *cumpv);
+/*---------------------------------------------------------------------------*/
+/* Find index in table of cumulated probabilities.                           */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+
+#define GEN    ((struct unur_dgt_gen*)gen->datap)
+/* data for generator object */
+
+#define DISTR  (gen->distr->data.discr)
+/* data for distribution in generator object */
+
+/*****************************************************************************/
+
+void
+_Runuran_pack_dgt (struct unur_gen *gen, SEXP sexp_unur)
+     /*----------------------------------------------------------------------*/
+     /* Pack Runuran generator object for method DGT into R list             */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen  ... pointer to UNU.RAN generator object                       */
+     /*   unur ... 'Runuran' object (S4 class)                               */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  /* names of list entries */
+  SEXP sexp_data_names;
+
+  /* data list and its entries */
+  SEXP sexp_data, sexp_dom;
+  SEXP sexp_mid, sexp_lb, sexp_sum, sexp_guide, sexp_cumpv;
+
+  /* create entries for data list */
+
+  /* method ID (int) */
+  PROTECT(sexp_mid = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_mid)[0] = UNUR_METH_DGT;
+
+  /* left boundary of domain (int) */
+  PROTECT(sexp_lb = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_lb)[0] = DISTR.domain[0];
+
+  /* sum over all probabilities (double) */
+  PROTECT(sexp_sum = Rf_allocVector(REALSXP, 1));
+  REAL(sexp_sum)[0] = GEN->sum;
+
+  /* guide table (int[]) */
+  PROTECT(sexp_guide = Rf_allocVector(INTSXP, GEN->guide_size));
+  memcpy(INTEGER(sexp_guide), GEN->guide_table, GEN->guide_size * sizeof(int));
+
+  /* cumulated probabilities (double[]) */
+  PROTECT(sexp_cumpv = Rf_allocVector(REALSXP, DISTR.n_pv));
+  memcpy(REAL(sexp_cumpv), GEN->cumpv, DISTR.n_pv * sizeof(double));
+
+  /* list of "names" attribute of the objects in our list */
+  PROTECT(sexp_data_names = Rf_allocVector(STRSXP, n_slots));
+  for (i=0; i<n_slots; i++)
+    SET_STRING_ELT(sexp_data_names, i, Rf_mkChar(slot_name[i]));
+
+  /* create data list */
+  PROTECT(sexp_data = Rf_allocVector(VECSXP, n_slots));
+  SET_VECTOR_ELT(sexp_data, pmid,   sexp_mid);      /* attach 'mid' element   */
+  SET_VECTOR_ELT(sexp_data, plb,    sexp_lb);       /* attach 'lb' element    */
+  SET_VECTOR_ELT(sexp_data, psum,   sexp_sum);      /* attach 'sum' element   */
+  SET_VECTOR_ELT(sexp_data, pguide, sexp_guide);    /* attach 'guide' element */
+  SET_VECTOR_ELT(sexp_data, pcumpv, sexp_cumpv);    /* attach 'cumpv' element */
+
+  /* attach vector names */
+  Rf_setAttrib(sexp_data, R_NamesSymbol, sexp_data_names);
+
+  /* store in slot 'data' of S4 object 'unur' */
+  R_do_slot_assign(sexp_unur, Rf_install("data"), sexp_data);
+
+  /* set domain of distribution and store in slot 'dom' */
+  PROTECT(sexp_dom = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_dom)[0] = (double) DISTR.domain[0];
+  REAL(sexp_dom)[1] = (double) DISTR.domain[1];
+  R_do_slot_assign(sexp_unur, Rf_install("dom"), sexp_dom);
+
+  /* o.k. */
+  UNPROTECT(8);
+  return;
+
+} /* end of _Runuran_pack_dgt() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_sample_dgt (const struct Runuran_packed *data, int n)
+     /*----------------------------------------------------------------------*/
+     /* Sample from generator object: use R data list (packed object)        */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   data ... tables of packed generator object                         */
+     /*   n    ... sample size (positive integer)                            */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   random sample of size 'n'                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  double *res;
+  SEXP sexp_res = R_NilValue;
+
+  /* extract data */
+  int lb = PACKED_INT(data, plb)[0];
+  double sum = PACKED_REAL(data, psum)[0];
+  const int *guide = PACKED_INT(data, pguide);
+  int guide_size = PACKED_LENGTH(data, pguide);
+  const double *cumpv = PACKED_REAL(data, pcumpv);
+
+  /* generate sample */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+  for (i=0; i<n; i++) {
+    /* FIXME: R built-in URNG hard coded ! */
+    res[i] = (double) (lb + _dgt_eval (unif_rand(), sum, guide_size, guide, cumpv));
+  }
+
+  /* return result to R */
+  UNPROTECT(1);
+  return sexp_res;
+
+} /* end of _Runuran_sample_dgt() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_quantile_dgt (const struct Runuran_packed *data, SEXP sexp_U)
+     /*----------------------------------------------------------------------*/
+     /* Evaluate approximate quantile function:  use R data list (packed)    */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   data ... tables of packed generator object                         */
+     /*   U    ... u-value (numeric array)                                   */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   quantiles for given 'U' values                                     */
+     /*----------------------------------------------------------------------*/
+{
+  int i,n;
+  double *U, *res;
+  const double *dom;
+  int j;
+  SEXP sexp_res = R_NilValue;
+
+  /* extract data */
+  int lb = PACKED_INT(data, plb)[0];
+  double sum = PACKED_REAL(data, psum)[0];
+  const int *guide = PACKED_INT(data, pguide);
+  int guide_size = PACKED_LENGTH(data, pguide);
+  const double *cumpv = PACKED_REAL(data, pcumpv);
+
+  /* Extract U */
+  U = REAL(sexp_U);
+  n = Rf_length(sexp_U);
+
+  /* domain of distribution */
+  dom = data->dom;
+
+  /* evaluate inverse CDF */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+  for (i=0; i<n; i++) {
+    if (ISNAN(U[i]))
+      /* if NA or NaN is given then we simply return the same value */
+      res[i] = U[i];
+
+    else if (U[i] <= 0. ||  U[i] >= 1.) {
+      /* same bahavior as in UNU.RAN */
+      if (U[i] < 0. ||  U[i] > 1.)
+	Rf_warning("[UNU.RAN - warning] argument out of domain: U not in [0,1]");
+      res[i] = (U[i] <= 0.) ? dom[0] : dom[1];
+    }
+
+    else {
+      j = lb + _dgt_eval (U[i], sum, guide_size, guide, cumpv);
+      res[i] = (j < dom[0]) ? dom[0] : ((j > dom[1]) ? dom[1] : (double) j);
+    }
+  }
+
+  /* return result to R */
+  UNPROTECT(1);
+  return sexp_res;
+
+} /* end of _Runuran_quantile_dgt() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_dgt_eval (double U, double sum, int guide_size, const int *guide, const double *cumpv)
+     /*----------------------------------------------------------------------*/
+     /* Find index in table of cumulated probabilities (indexed search).     */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   U          ... u-value ~ U(0,1)                                    */
+     /*   sum        ... sum over all probabilities                          */
+     /*   guide_size ... size of guide table                                 */
+     /*   guide      ... guide table                                         */
+     /*   cumpv      ... table of cumulated probabilities                    */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   index j (relative to left boundary of domain)                      */
+     /*----------------------------------------------------------------------*/
+{
+  int j;
+
+  j = guide[(int)(U * guide_size)];
+  U *= sum;
+  while (cumpv[j] < U) j++;
+
+  return j;
+
+} /* end of _dgt_eval() */
+
+/*---------------------------------------------------------------------------*/
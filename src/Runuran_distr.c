@@ -35,6 +35,10 @@
 
 #include "Runuran.h"
 
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+#include <parser/functparser_source.h>
+
 /*---------------------------------------------------------------------------*/
 
 /* structure for storing pointers to R objects                               */
@@ -77,6 +81,10 @@ static double _Runuran_cont_eval_pdf( double x, const struct unur_distr *distr )
 static double _Runuran_cont_eval_dpdf( double x, const struct unur_distr *distr );
 /* Evaluate derivative of PDF function.                                      */
 
+static int _Runuran_cont_eval_pdf_array( const double *x, double *fx, int n,
+					 const struct unur_distr *distr );
+/* Evaluate (vectorized) PDF function for an array of points.                */
+
 /*---------------------------------------------------------------------------*/
 /*  Continuous Multivariate Distributions (CMV)                              */
 
@@ -253,6 +261,7 @@ _Runuran_discr_eval_pmf( int k, const struct unur_distr *distr )
 SEXP
 Runuran_cont_init (SEXP sexp_obj, SEXP sexp_env, 
 		   SEXP sexp_cdf, SEXP sexp_pdf, SEXP sexp_dpdf, SEXP sexp_islog,
+		   SEXP sexp_vectorized,
 		   SEXP sexp_mode, SEXP sexp_center, SEXP sexp_domain,
 		   SEXP sexp_area, SEXP sexp_name)
      /*----------------------------------------------------------------------*/
@@ -265,6 +274,7 @@ Runuran_cont_init (SEXP sexp_obj, SEXP sexp_env,
      /*   pdf    ... PDF of distribution                                     */
      /*   dpdf   ... derivative of PDF of distribution                       */
      /*   islog  ... boolean: TRUE if logarithms of CDF|PDF|dPDF are given   */
+     /*   vectorized ... boolean: TRUE if PDF accepts a vector of points     */
      /*   mode   ... mode of distribution                                    */
      /*   center ... "center" (typical point) of distribution                */
      /*   domain ... domain of distribution                                  */
@@ -279,6 +289,7 @@ Runuran_cont_init (SEXP sexp_obj, SEXP sexp_env,
   double mode, center, area;
   const char *name;
   int islog;
+  int vectorized;
   unsigned int error = 0u;
 
 #ifdef RUNURAN_DEBUG
@@ -298,6 +309,9 @@ Runuran_cont_init (SEXP sexp_obj, SEXP sexp_env,
   /* whether we are given logarithm of CDF|PDF|dPDF or not */
   islog = LOGICAL(sexp_islog)[0];
 
+  /* whether the PDF can be evaluated for a vector of points in one call */
+  vectorized = (LOGICAL(sexp_vectorized)[0] == TRUE) ? TRUE : FALSE;
+
   /* store pointers to R objects */
   Rdistr = R_Calloc(1,struct Runuran_distr_cont);
   Rdistr->env = sexp_env;
@@ -317,16 +331,22 @@ Runuran_cont_init (SEXP sexp_obj, SEXP sexp_env,
   if (islog) {
     if (!Rf_isNull(sexp_cdf))
       error |= unur_distr_cont_set_logcdf(distr, _Runuran_cont_eval_cdf);
-    if (!Rf_isNull(sexp_pdf))
+    if (!Rf_isNull(sexp_pdf)) {
       error |= unur_distr_cont_set_logpdf(distr, _Runuran_cont_eval_pdf);
+      if (vectorized)
+	error |= unur_distr_cont_set_logpdf_array(distr, _Runuran_cont_eval_pdf_array);
+    }
     if (!Rf_isNull(sexp_dpdf))
       error |= unur_distr_cont_set_dlogpdf(distr, _Runuran_cont_eval_dpdf);
   }
   else {
     if (!Rf_isNull(sexp_cdf))
       error |= unur_distr_cont_set_cdf(distr, _Runuran_cont_eval_cdf);
-    if (!Rf_isNull(sexp_pdf))
+    if (!Rf_isNull(sexp_pdf)) {
       error |= unur_distr_cont_set_pdf(distr, _Runuran_cont_eval_pdf);
+      if (vectorized)
+	error |= unur_distr_cont_set_pdf_array(distr, _Runuran_cont_eval_pdf_array);
+    }
     if (!Rf_isNull(sexp_dpdf))
       error |= unur_distr_cont_set_dpdf(distr, _Runuran_cont_eval_dpdf);
   }
@@ -432,6 +452,68 @@ _Runuran_cont_eval_dpdf( double x, const struct unur_distr *distr )
   return y;
 } /* end of _Runuran_cont_eval_dpdf() */
 
+/*---------------------------------------------------------------------------*/
+
+int
+_Runuran_cont_eval_pdf_array( const double *x, double *fx, int n,
+			      const struct unur_distr *distr )
+     /*----------------------------------------------------------------------*/
+     /* Evaluate (vectorized) PDF function for an array of points.           */
+     /* The R function is called only once for all 'n' points.              */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   UNUR_SUCCESS, or UNUR_FAILURE if the R function does not return    */
+     /*   a numeric vector of length 'n' (the caller then falls back to      */
+     /*   evaluating the PDF pointwise).                                     */
+     /*----------------------------------------------------------------------*/
+{
+  const struct Runuran_distr_cont *Rdistr;
+  SEXP R_fcall, arg, res;
+
+  Rdistr = unur_distr_get_extobj(distr);
+  PROTECT(arg = Rf_allocVector(REALSXP, n));
+  memcpy(REAL(arg), x, n * sizeof(double));
+  PROTECT(R_fcall = Rf_lang2(Rdistr->pdf, arg));
+  PROTECT(res = Rf_eval(R_fcall, Rdistr->env));
+  if (TYPEOF(res) != REALSXP || Rf_length(res) != n) {
+    UNPROTECT(3);
+    return UNUR_FAILURE;
+  }
+  memcpy(fx, REAL(res), n * sizeof(double));
+  UNPROTECT(3);
+  return UNUR_SUCCESS;
+} /* end of _Runuran_cont_eval_pdf_array() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_cont_get_pdf( const struct unur_distr *distr, int *islog )
+     /*----------------------------------------------------------------------*/
+     /* Get PDF (or logPDF) of distribution as R function.                   */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   distr ... pointer to UNU.RAN distribution object                   */
+     /*   islog ... pointer for storing whether the logPDF is returned       */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   R function, or R_NilValue if the PDF is not given as R function    */
+     /*   (e.g., for UNU.RAN built-in distributions)                         */
+     /*----------------------------------------------------------------------*/
+{
+  const struct Runuran_distr_cont *Rdistr;
+
+  *islog = FALSE;
+
+  /* the PDF must be evaluated by our wrapper for R functions */
+  if (unur_distr_cont_get_logpdf(distr) == _Runuran_cont_eval_pdf)
+    *islog = TRUE;
+  else if (unur_distr_cont_get_pdf(distr) != _Runuran_cont_eval_pdf)
+    return R_NilValue;
+
+  Rdistr = unur_distr_get_extobj(distr);
+  return (Rdistr == NULL) ? R_NilValue : Rdistr->pdf;
+} /* end of _Runuran_cont_get_pdf() */
+
 
 /*****************************************************************************/
 /*                                                                           */
@@ -705,6 +787,153 @@ Runuran_std_discr (SEXP sexp_obj, SEXP sexp_name, SEXP sexp_params, SEXP sexp_do
   return (sexp_distr);
 } /* end of Runuran_std_discr() */
 
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_std_cmv (SEXP sexp_obj, SEXP sexp_name, SEXP sexp_mean, SEXP sexp_covar)
+     /*----------------------------------------------------------------------*/
+     /* Create UNU.RAN object for special multivariate distribution.         */
+     /* Currently only "multinormal" is available (used by tests for method  */
+     /* MVSTD).                                                              */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   obj    ... S4 class that contains unuran distribution object       */ 
+     /*   name   ... name of special distribution                            */
+     /*   mean   ... mean vector                                             */
+     /*   covar  ... covariance matrix (or NULL for identity matrix)         */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_distr;
+  struct unur_distr *distr;
+  const char *name;
+  int dim;
+
+  /* name of distribution */
+  if (! (sexp_name && TYPEOF(sexp_name) == STRSXP && Rf_length(sexp_name) == 1))
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'name'");
+  name = CHAR(STRING_ELT(sexp_name,0));
+  if (strcmp(name, "multinormal"))
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] unknown distribution '%s'", name);
+
+  /* mean vector */
+  if (! (sexp_mean && TYPEOF(sexp_mean)==REALSXP && Rf_length(sexp_mean)>0) )
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'mean'");
+  dim = Rf_length(sexp_mean);
+
+  /* covariance matrix */
+  if (! (Rf_isNull(sexp_covar) ||
+	 (TYPEOF(sexp_covar)==REALSXP && Rf_length(sexp_covar)==dim*dim)) )
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'covar'");
+
+  /* create distribution object */
+  distr = unur_distr_multinormal( dim, REAL(sexp_mean),
+				  Rf_isNull(sexp_covar) ? NULL : REAL(sexp_covar) );
+  if (distr == NULL) { _Runuran_fatal(); }
+
+  /* make R external pointer and store pointer to structure */
+  PROTECT(sexp_distr = R_MakeExternalPtr(distr, _Runuran_distr_tag(), sexp_obj));
+  
+  /* register destructor as C finalizer */
+  R_RegisterCFinalizer(sexp_distr, _Runuran_distr_free);
+
+  /* return pointer to R */
+  UNPROTECT(1);
+  return (sexp_distr);
+} /* end of Runuran_std_cmv() */
+
+
+/*****************************************************************************/
+/*                                                                           */
+/*  Function Strings                                                         */
+/*                                                                           */
+/*****************************************************************************/
+
+SEXP
+Runuran_fstr_eval (SEXP sexp_fstr, SEXP sexp_x, SEXP sexp_op)
+     /*----------------------------------------------------------------------*/
+     /* Internal function for testing the function parser:                   */
+     /* evaluate function string by means of the parse tree, the compiled    */
+     /* program and the array evaluator.                                     */
+     /*                                                                      */
+     /* Operations:                                                          */
+     /*   "funct" ... function given by string                               */
+     /*   "deriv" ... derivative of function                                 */
+     /*   "dup"   ... copy of parse tree of function                         */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   fstr ... function string (string)                                  */
+     /*   x    ... x-values (numeric array)                                  */
+     /*   op   ... operation (string)                                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   matrix with columns: tree evaluation, program, array evaluator     */
+     /*----------------------------------------------------------------------*/
+{
+  struct ftreenode *tree, *root;
+  struct ftreeprog *prog;
+  const char *op;
+  const double *x;
+  double *res;
+  SEXP sexp_res;
+  int i, n;
+
+  /* check arguments */
+  if (! (Rf_isString(sexp_fstr) && Rf_length(sexp_fstr) == 1))
+    Rf_error("[UNU.RAN - error] argument invalid: 'fstr' must be string");
+  if (! (Rf_isString(sexp_op) && Rf_length(sexp_op) == 1))
+    Rf_error("[UNU.RAN - error] argument invalid: 'op' must be string");
+  op = CHAR(STRING_ELT(sexp_op, 0));
+  if (strcmp(op, "funct") && strcmp(op, "deriv") && strcmp(op, "dup"))
+    Rf_error("[UNU.RAN - error] argument invalid: unknown operation '%s'", op);
+
+  /* allocate memory for result */
+  PROTECT(sexp_x = Rf_coerceVector(sexp_x, REALSXP));
+  x = REAL(sexp_x);
+  n = Rf_length(sexp_x);
+  PROTECT(sexp_res = Rf_allocMatrix(REALSXP, n, 3));
+  res = REAL(sexp_res);
+
+  /* parse function string */
+  tree = _unur_fstr2tree(CHAR(STRING_ELT(sexp_fstr, 0)));
+  if (tree == NULL) {
+    UNPROTECT(2);
+    Rf_error("[UNU.RAN - error] cannot parse function string");
+  }
+  if (!strcmp(op, "deriv"))
+    root = _unur_fstr_make_derivative(tree);
+  else if (!strcmp(op, "dup"))
+    root = _unur_fstr_dup_tree(tree);
+  else
+    root = tree;
+  if (root == NULL || root->prog == NULL) {
+    if (root != tree) _unur_fstr_free(root);
+    _unur_fstr_free(tree);
+    UNPROTECT(2);
+    Rf_error("[UNU.RAN - error] function string not compiled");
+  }
+
+  /* evaluate parse tree (hide compiled program) */
+  prog = root->prog;
+  root->prog = NULL;
+  for (i=0; i<n; i++)
+    res[i] = _unur_fstr_eval_tree(root, x[i]);
+  root->prog = prog;
+
+  /* evaluate compiled program */
+  for (i=0; i<n; i++)
+    res[n+i] = _unur_fstr_eval_tree(root, x[i]);
+
+  /* array evaluator */
+  _unur_fstr_eval_tree_array(root, x, res+2*n, n);
+
+  /* clear memory */
+  if (root != tree) _unur_fstr_free(root);
+  _unur_fstr_free(tree);
+
+  UNPROTECT(2);
+  return sexp_res;
+
+} /* end of Runuran_fstr_eval() */
 
 /*****************************************************************************/
 /*                                                                           */
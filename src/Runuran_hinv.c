@@ -0,0 +1,307 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_hinv.c                                                    *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         R interface for UNU.RAN -- HINV                                   *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+#include <methods/hinv_struct.h>
+
+/*---------------------------------------------------------------------------*/
+
+/* number of entries (slots) in data list */
+#define n_slots (6)
+
+/* names of slots */
+static const char *slot_name[n_slots] = {"mid","order","Urange","trunc","guide","iv"};
+
+/* positions in data list */
+enum {
+  pmid = 0,      /* method ID [ This MUST be 0 ! ] */
+  porder = 1,    /* order of polynomial */
+  pUrange = 2,   /* Umin and Umax */
+  ptrunc = 3,    /* truncated domain of distribution */
+  pguide = 4,    /* guide table */
+  piv = 5        /* table of intervals */
+};
+
+/*---------------------------------------------------------------------------*/
+
+static double _hinv_eval (double U, int order, int guide_size, const int *guide, const double *iv);
+/*---------------------------------------------------------------------------*/
+/* Evaluate approximating polynomial.                                        */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+
+#define GEN    ((struct unur_hinv_gen*)gen->datap)
+/* data for generator object */
+
+#define DISTR  (gen->distr->data.cont)
+/* data for distribution in generator object */
+
+/*****************************************************************************/
+
+void
+_Runuran_pack_hinv (struct unur_gen *gen, SEXP sexp_unur)
+     /*----------------------------------------------------------------------*/
+     /* Pack Runuran generator object for method HINV into R list            */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen  ... pointer to UNU.RAN generator object                       */
+     /*   unur ... 'Runuran' object (S4 class)                               */
+     /*----------------------------------------------------------------------*/
+{
+  int i, n_iv;
+
+  /* names of list entries */
+  SEXP sexp_data_names;
+
+  /* data list and its entries */
+  SEXP sexp_data, sexp_dom;
+  SEXP sexp_mid, sexp_order, sexp_Urange, sexp_trunc, sexp_guide, sexp_iv;
+
+  /* create entries for data list */
+
+  /* method ID (int) */
+  PROTECT(sexp_mid = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_mid)[0] = UNUR_METH_HINV;
+
+  /* order (int) */
+  PROTECT(sexp_order = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_order)[0] = GEN->order;
+
+  /* Umin and Umax (double[2]) */
+  PROTECT(sexp_Urange = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_Urange)[0] = GEN->Umin;
+  REAL(sexp_Urange)[1] = GEN->Umax;
+
+  /* truncated domain (double[2]) */
+  PROTECT(sexp_trunc = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_trunc)[0] = DISTR.trunc[0];
+  REAL(sexp_trunc)[1] = DISTR.trunc[1];
+
+  /* guide table (int[]) */
+  /* (entries are positions in table of intervals) */
+  PROTECT(sexp_guide = Rf_allocVector(INTSXP, GEN->guide_size));
+  for (i=0; i<GEN->guide_size; i++) {
+    INTEGER(sexp_guide)[i] = GEN->guide[i];
+  }
+
+  /* table of intervals: for each interval                  */
+  /*   u-value of left boundary, coefficients of polynomial  */
+  n_iv = GEN->N * (GEN->order+2);
+  PROTECT(sexp_iv = Rf_allocVector(REALSXP, n_iv));
+  memcpy(REAL(sexp_iv), GEN->intervals, n_iv * sizeof(double));
+
+  /* list of "names" attribute of the objects in our list */
+  PROTECT(sexp_data_names = Rf_allocVector(STRSXP, n_slots));
+  for (i=0; i<n_slots; i++)
+    SET_STRING_ELT(sexp_data_names, i, Rf_mkChar(slot_name[i]));
+
+  /* create data list */
+  PROTECT(sexp_data = Rf_allocVector(VECSXP, n_slots));
+  SET_VECTOR_ELT(sexp_data, pmid,    sexp_mid);      /* attach 'mid' element    */
+  SET_VECTOR_ELT(sexp_data, porder,  sexp_order);    /* attach 'order' element  */
+  SET_VECTOR_ELT(sexp_data, pUrange, sexp_Urange);   /* attach 'Urange' element */
+  SET_VECTOR_ELT(sexp_data, ptrunc,  sexp_trunc);    /* attach 'trunc' element  */
+  SET_VECTOR_ELT(sexp_data, pguide,  sexp_guide);    /* attach 'guide' element  */
+  SET_VECTOR_ELT(sexp_data, piv,     sexp_iv);       /* attach 'iv' element     */
+
+  /* attach vector names */
+  Rf_setAttrib(sexp_data, R_NamesSymbol, sexp_data_names);
+
+  /* store in slot 'data' of S4 object 'unur' */
+  R_do_slot_assign(sexp_unur, Rf_install("data"), sexp_data);
+
+  /* set domain of distribution and store in slot 'dom' */
+  PROTECT(sexp_dom = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_dom)[0] = DISTR.domain[0];
+  REAL(sexp_dom)[1] = DISTR.domain[1];
+  R_do_slot_assign(sexp_unur, Rf_install("dom"), sexp_dom);
+
+  /* o.k. */
+  UNPROTECT(10);
+  return;
+
+} /* end of _Runuran_pack_hinv() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_sample_hinv (const struct Runuran_packed *data, int n)
+     /*----------------------------------------------------------------------*/
+     /* Sample from generator object: use R data list (packed object)        */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   data ... tables of packed generator object                         */
+     /*   n    ... sample size (positive integer)                            */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   random sample of size 'n'                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  double U, X;
+  double *res;
+  SEXP sexp_res = R_NilValue;
+
+  /* extract data */
+  int order = PACKED_INT(data, porder)[0];
+  double Umin = PACKED_REAL(data, pUrange)[0];
+  double Umax = PACKED_REAL(data, pUrange)[1];
+  const double *trunc = PACKED_REAL(data, ptrunc);
+  const int *guide = PACKED_INT(data, pguide);
+  int guide_size = PACKED_LENGTH(data, pguide);
+  const double *iv = PACKED_REAL(data, piv);
+
+  /* generate sample */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+  for (i=0; i<n; i++) {
+    U = Umin + unif_rand() * (Umax - Umin);   /* FIXME: R built-in URNG hard coded ! */
+    X = _hinv_eval (U, order, guide_size, guide, iv);
+    res[i] = (X<trunc[0]) ? trunc[0] : ((X>trunc[1]) ? trunc[1] : X);
+  }
+
+  /* return result to R */
+  UNPROTECT(1);
+  return sexp_res;
+
+} /* end of _Runuran_sample_hinv() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_quantile_hinv (const struct Runuran_packed *data, SEXP sexp_U)
+     /*----------------------------------------------------------------------*/
+     /* Evaluate approximate quantile function:  use R data list (packed)    */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   data ... tables of packed generator object                         */
+     /*   U    ... u-value (numeric array)                                   */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   (approximate) quantiles for given 'U' values                       */
+     /*----------------------------------------------------------------------*/
+{
+  int i,n;
+  double *U, X;
+  double *res;
+  SEXP sexp_res = R_NilValue;
+
+  /* extract data */
+  int order = PACKED_INT(data, porder)[0];
+  double Umin = PACKED_REAL(data, pUrange)[0];
+  double Umax = PACKED_REAL(data, pUrange)[1];
+  const double *trunc = PACKED_REAL(data, ptrunc);
+  const int *guide = PACKED_INT(data, pguide);
+  int guide_size = PACKED_LENGTH(data, pguide);
+  const double *iv = PACKED_REAL(data, piv);
+
+  /* Extract U */
+  U = REAL(sexp_U);
+  n = Rf_length(sexp_U);
+
+  /* evaluate inverse CDF */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+  for (i=0; i<n; i++) {
+    if (ISNAN(U[i]))
+      /* if NA or NaN is given then we simply return the same value */
+      res[i] = U[i];
+
+    else if (U[i] <= 0. ||  U[i] >= 1.) {
+      /* same bahavior as in UNU.RAN */
+      if (U[i] < 0. ||  U[i] > 1.)
+	Rf_warning("[UNU.RAN - warning] argument out of domain: U not in [0,1]");
+      res[i] = (U[i] <= 0.) ? trunc[0] : trunc[1];
+    }
+
+    else {
+      X = _hinv_eval (Umin + U[i] * (Umax - Umin), order, guide_size, guide, iv);
+      res[i] = (X<trunc[0]) ? trunc[0] : ((X>trunc[1]) ? trunc[1] : X);
+    }
+  }
+
+  /* return result to R */
+  UNPROTECT(1);
+  return sexp_res;
+
+} /* end of _Runuran_quantile_hinv() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_hinv_eval (double U, int order, int guide_size, const int *guide, const double *iv)
+     /*----------------------------------------------------------------------*/
+     /* Evaluate approximating polynomial.                                   */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   U          ... u-value in (Umin,Umax)                              */
+     /*   order      ... order of Hermite polynomial                         */
+     /*   guide_size ... size of guide table                                 */
+     /*   guide      ... guide table                                         */
+     /*   iv         ... table of intervals                                  */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   (approximate) quantile for given 'U' value                         */
+     /*----------------------------------------------------------------------*/
+{
+  int i, k, width;
+  double X;
+  const double *c;
+
+  /* number of entries per interval */
+  width = order + 2;
+
+  /* find interval */
+  i = guide[(int) (guide_size*U)];
+  while (U > iv[i+width])
+    i += width;
+
+  /* rescale U to [0,1] and evaluate polynomial (Horner scheme) */
+  U = (U-iv[i])/(iv[i+width] - iv[i]);
+  c = iv+i+1;
+  X = c[order];
+  for (k=order-1; k>=0; k--)
+    X = U*X + c[k];
+
+  /* return result */
+  return X;
+
+} /* end of _hinv_eval() */
+
+/*---------------------------------------------------------------------------*/
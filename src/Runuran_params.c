@@ -0,0 +1,137 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_params.c                                                  *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         Sample from special distributions with one parameter set per      *
+ *         random variate.                                                   *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   The convenience functions ur...() (e.g. urpois()) accept vectors of     *
+ *   parameters. Then a single generator object of method CSTD or DSTD is   *
+ *   created and the parameters of its distribution are changed in place.   *
+ *   The random variates are grouped by parameter set such that the setup   *
+ *   of the special generator is run only once for each distinct set.        *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_sample_params (SEXP sexp_name, SEXP sexp_params)
+     /*----------------------------------------------------------------------*/
+     /* Sample from special distribution with one parameter set per draw.    */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   name   ... name of special distribution                            */
+     /*   params ... matrix of parameter values (one row for each draw)      */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   random sample of size 'nrow(params)'                               */
+     /*----------------------------------------------------------------------*/
+{
+  const char *name;
+  double *params;
+  int n, n_params;
+  struct unur_distr *distr;
+  struct unur_gen *gen = NULL;
+  SEXP sexp_res;
+  double *res;
+  int *K;
+  int i,j;
+  int is_discr = FALSE;
+  int rcode;
+
+  /* name of distribution */
+  if (! (sexp_name && TYPEOF(sexp_name) == STRSXP && Rf_length(sexp_name) == 1))
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'name'");
+  name = CHAR(STRING_ELT(sexp_name,0));
+
+  /* parameters: R stores the matrix by columns, UNU.RAN expects rows */
+  if (! (sexp_params && TYPEOF(sexp_params)==REALSXP && Rf_isMatrix(sexp_params)) )
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'params'");
+  n = Rf_nrows(sexp_params);
+  n_params = Rf_ncols(sexp_params);
+  if (n <= 0 || n_params <= 0)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid argument 'params'");
+  params = (double *) R_alloc((size_t) n * n_params, sizeof(double));
+  for (i=0; i<n; i++)
+    for (j=0; j<n_params; j++)
+      params[i*n_params+j] = REAL(sexp_params)[i + (size_t)n*j];
+
+  /* create generator object for first parameter set */
+  distr = _Runuran_get_std_cont( name, params, n_params );
+  if (distr != NULL) {
+    gen = unur_init( unur_cstd_new(distr) );
+  }
+  else {
+    distr = _Runuran_get_std_discr( name, params, n_params );
+    if (distr != NULL) {
+      is_discr = TRUE;
+      gen = unur_init( unur_dstd_new(distr) );
+    }
+  }
+  if (distr) unur_distr_free(distr);
+  if (gen == NULL)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot create UNU.RAN object");
+
+  /* get state for the R built-in URNG */
+  GetRNGstate();
+  unur_urng_flush_buffer(unur_get_urng(gen));
+
+  /* run generator */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+  if (is_discr) {
+    K = (int *) R_alloc((size_t) n, sizeof(int));
+    rcode = unur_dstd_sample_params(gen, params, n_params, K, n);
+    for (i=0; i<n; i++) res[i] = (double) K[i];
+  }
+  else {
+    rcode = unur_cstd_sample_params(gen, params, n_params, res, n);
+  }
+
+  /* update state for the R built-in URNG */
+  PutRNGstate();
+  unur_free(gen);
+
+  if (rcode != UNUR_SUCCESS)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid parameters for distribution '%s'",
+		 name);
+
+  /* return result to R */
+  UNPROTECT(1);
+  return sexp_res;
+
+} /* end of Runuran_sample_params() */
+
+/*---------------------------------------------------------------------------*/
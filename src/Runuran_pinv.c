@@ -59,7 +59,7 @@ enum {
 /*---------------------------------------------------------------------------*/
 
 static double _pinv_eval (double U, double Umax, int order,
-			  int guide_size, int *guide, double *iv);
+			  int guide_size, const int *guide, const double *iv);
 /*---------------------------------------------------------------------------*/
 /* Evaluate approximating polynomial.                                        */
 /*---------------------------------------------------------------------------*/
@@ -90,6 +90,7 @@ _Runuran_pack_pinv (struct unur_gen *gen, SEXP sexp_unur)
   int i,n,k;
   int iv_size, n_coeff;
   double *iv;
+  const double *ui, *zi;
 
   /* names of list entries */
   SEXP sexp_data_names;
@@ -131,14 +132,16 @@ _Runuran_pack_pinv (struct unur_gen *gen, SEXP sexp_unur)
   PROTECT(sexp_iv = Rf_allocVector(REALSXP, n_coeff));
   iv = REAL(sexp_iv);
   for (i=0,n=-1; i<=GEN->n_ivs; i++) {
-    iv[++n] = GEN->iv[i].cdfi;
+    ui = GEN->coeff + 2*GEN->order*i;
+    zi = ui + GEN->order;
+    iv[++n] = GEN->cdfi[i];
     k = GEN->order - 1;
-    iv[++n] = GEN->iv[i].zi[k];
+    iv[++n] = zi[k];
     for (k--; k>=0; k--) {
-      iv[++n] = GEN->iv[i].ui[k];
-      iv[++n] = GEN->iv[i].zi[k];
+      iv[++n] = ui[k];
+      iv[++n] = zi[k];
     }
-    iv[++n] = GEN->iv[i].xi;
+    iv[++n] = GEN->xi[i];
   }
 
   /* list of "names" attribute of the objects in our list */
@@ -175,12 +178,12 @@ _Runuran_pack_pinv (struct unur_gen *gen, SEXP sexp_unur)
 /*---------------------------------------------------------------------------*/
 
 SEXP
-_Runuran_sample_pinv (SEXP sexp_data, int n)
+_Runuran_sample_pinv (const struct Runuran_packed *data, int n)
      /*----------------------------------------------------------------------*/
      /* Sample from generator object: use R data list (packed object)        */
      /*                                                                      */
      /* Parameters:                                                          */
-     /*   data ... data for generation method (R list)                       */
+     /*   data ... tables of packed generator object                         */
      /*   n    ... sample size (positive integer)                            */
      /*                                                                      */
      /* Return:                                                              */
@@ -192,11 +195,11 @@ _Runuran_sample_pinv (SEXP sexp_data, int n)
   SEXP sexp_res = R_NilValue;
 
   /* extract data */
-  int order = INTEGER(VECTOR_ELT(sexp_data, porder))[0];
-  double Umax = REAL(VECTOR_ELT(sexp_data, pUmax))[0];
-  int *guide = INTEGER(VECTOR_ELT(sexp_data, pguide));
-  int guide_size = Rf_length(VECTOR_ELT(sexp_data, pguide));
-  double *iv = REAL(VECTOR_ELT(sexp_data, piv));
+  int order = PACKED_INT(data, porder)[0];
+  double Umax = PACKED_REAL(data, pUmax)[0];
+  const int *guide = PACKED_INT(data, pguide);
+  int guide_size = PACKED_LENGTH(data, pguide);
+  const double *iv = PACKED_REAL(data, piv);
   
   /* generate sample */
   PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
@@ -215,14 +218,13 @@ _Runuran_sample_pinv (SEXP sexp_data, int n)
 /*---------------------------------------------------------------------------*/
 
 SEXP
-_Runuran_quantile_pinv (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur)
+_Runuran_quantile_pinv (const struct Runuran_packed *data, SEXP sexp_U)
      /*----------------------------------------------------------------------*/
      /* Evaluate approximate quantile function:  use R data list (packed)    */
      /*                                                                      */
      /* Parameters:                                                          */
-     /*   data ... data for generation method (R list)                       */
+     /*   data ... tables of packed generator object                         */
      /*   U    ... u-value (numeric array)                                   */
-     /*   unur ... 'Runuran' object (S4 class)                               */ 
      /*                                                                      */
      /* Return:                                                              */
      /*   (approximate) quantiles for given 'U' values                       */
@@ -232,23 +234,17 @@ _Runuran_quantile_pinv (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur)
   double *U;
   SEXP sexp_res = R_NilValue;
 
-  /* domain of distribution */
-  SEXP sexp_dom  = R_NilValue;
-
   /* extract data */
-  int order = INTEGER(VECTOR_ELT(sexp_data, porder))[0];
-  double Umax = REAL(VECTOR_ELT(sexp_data, pUmax))[0];
-  int *guide = INTEGER(VECTOR_ELT(sexp_data, pguide));
-  int guide_size = Rf_length(VECTOR_ELT(sexp_data, pguide));
-  double *iv = REAL(VECTOR_ELT(sexp_data, piv));
+  int order = PACKED_INT(data, porder)[0];
+  double Umax = PACKED_REAL(data, pUmax)[0];
+  const int *guide = PACKED_INT(data, pguide);
+  int guide_size = PACKED_LENGTH(data, pguide);
+  const double *iv = PACKED_REAL(data, piv);
 
   /* Extract U */
   U = REAL(sexp_U);
   n = Rf_length(sexp_U);
 
-  /* domain of distribution */
-  PROTECT(sexp_dom = R_do_slot(sexp_unur, Rf_install("dom")));
-  
   /* evaluate inverse CDF */
   PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
   for (i=0; i<n; i++) {
@@ -263,9 +259,9 @@ _Runuran_quantile_pinv (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur)
 	if (U[i] < 0. ||  U[i] > 1.)
 	  Rf_warning("[UNU.RAN - warning] argument out of domain: U not in [0,1]");
 	if (U[i] < 0.5 )
-	  REAL(sexp_res)[i] = REAL(sexp_dom)[0];
+	  REAL(sexp_res)[i] = data->dom[0];
 	if (U[i] > 0.5 )
-	  REAL(sexp_res)[i] = REAL(sexp_dom)[1];
+	  REAL(sexp_res)[i] = data->dom[1];
       }
 
       else {
@@ -276,7 +272,7 @@ _Runuran_quantile_pinv (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur)
   }
 
   /* return result to R */
-  UNPROTECT(2);
+  UNPROTECT(1);
   return sexp_res;
  
 } /* end of _Runuran_quantile_pinv() */
@@ -284,7 +280,7 @@ _Runuran_quantile_pinv (SEXP sexp_data, SEXP sexp_U, SEXP sexp_unur)
 /*---------------------------------------------------------------------------*/
 
 double
-_pinv_eval (double U, double Umax, int order, int guide_size, int *guide, double *iv)
+_pinv_eval (double U, double Umax, int order, int guide_size, const int *guide, const double *iv)
      /*----------------------------------------------------------------------*/
      /* Evaluate approximating polynomial.                                   */
      /*                                                                      */
@@ -312,7 +308,10 @@ _pinv_eval (double U, double Umax, int order, int guide_size, int *guide, double
   V = Umax * U;
 
   /* find interval */
+  /* (the first step is branch free as the guide table mostly points */
+  /* to the correct interval or to its predecessor)                   */
   I = guide[(int) (U * guide_size)];
+  I += (V > iv[I+width]) * width;
   while (V > iv[I+width]) I+=width;
 
   /* compute interpolating polynomial for corresponding interval */
@@ -0,0 +1,914 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_table.c                                                   *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         Binary table files for packed generator objects.                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   The tables of a packed generator object (methods PINV, HINV, DGT, DAU)  *
+ *   can be written into a binary table file. Such a file can then be mapped *
+ *   read-only into memory and sampling (and quantile evaluation) works      *
+ *   directly on the mapped tables. Thus several R processes on the same     *
+ *   node share a single copy of the tables and no setup is required.        *
+ *                                                                           *
+ *   The file is position independent (all positions are offsets from the    *
+ *   beginning of the file) and uses the byte order of the machine where it  *
+ *   was created:                                                            *
+ *                                                                           *
+ *     header:  magic string "UNURTAB" (8 bytes), version, byte order mark,  *
+ *              method ID, number of tables, domain of distribution          *
+ *     entries: for each table: type (int|double), length, offset            *
+ *     tables:  contents of all tables, each aligned at 8 bytes              *
+ *                                                                           *
+ *   The tables are the same as the entries of the R data list of the        *
+ *   packed object (in the same order).                                      *
+ *                                                                           *
+ *   An existing table file is never overwritten in place: the new file is   *
+ *   written to a temporary file that then replaces the old one. Thus R      *
+ *   processes which have mapped the old file keep a consistent copy.        *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+
+#include <stdint.h>
+
+#ifdef _WIN32
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+/* Format of table file                                                      */
+
+#define TABLE_MAGIC      "UNURTAB"     /* magic string (including '\0') */
+#define TABLE_VERSION    (1u)          /* version of file format */
+#define TABLE_BYTEORDER  (0x01020304u) /* byte order mark */
+
+/* types of tables */
+#define TABLE_INT   (1)
+#define TABLE_REAL  (2)
+
+struct table_header {
+  char     magic[8];         /* magic string */
+  uint32_t version;          /* version of file format */
+  uint32_t byteorder;        /* byte order mark */
+  int32_t  mid;              /* method ID */
+  int32_t  n_slots;          /* number of tables */
+  double   dom[2];           /* domain of distribution */
+};
+
+struct table_entry {
+  int32_t  type;             /* type of table (TABLE_INT | TABLE_REAL) */
+  int32_t  length;           /* number of entries in table */
+  uint64_t offset;           /* position of table in file */
+};
+
+/* Layout of tables for supported methods:                                   */
+/*   'i' ... table of type int,  'r' ... table of type double.               */
+/* [ This MUST match the data lists in Runuran_<method>.c ! ]                */
+static const struct {
+  int mid;                   /* method ID */
+  const char *layout;        /* types of tables */
+} table_layout[] = {
+  { UNUR_METH_PINV, "iirir"  },   /* mid, order, Umax, guide, iv */
+  { UNUR_METH_HINV, "iirrir" },   /* mid, order, Urange, trunc, guide, iv */
+  { UNUR_METH_DGT,  "iirir"  },   /* mid, lb, sum, guide, cumpv */
+  { UNUR_METH_DAU,  "iiiri"  },   /* mid, lb, len, qx, jx */
+  { 0, NULL }
+};
+
+/*---------------------------------------------------------------------------*/
+
+/* mapped table file */
+struct Runuran_table {
+  void *addr;                /* start of mapped file */
+  size_t size;               /* size of file */
+};
+
+/* entries of data list for packed object with mapped table file */
+#define n_map_slots (5)
+static const char *slot_name[n_map_slots] = {"mid","file","map","size","checksum"};
+enum {
+  pmid = 0,      /* method ID [ This MUST be 0 ! ] */
+  pfile = 1,     /* name of table file */
+  pmap = 2,      /* pointer to mapped table file */
+  psize = 3,     /* size of table file */
+  pchecksum = 4  /* checksum of table file */
+};
+
+/*---------------------------------------------------------------------------*/
+
+static const char *_table_layout (int mid);
+/*---------------------------------------------------------------------------*/
+/* Get layout of tables for given method.                                    */
+/*---------------------------------------------------------------------------*/
+
+static int _table_write (const char *file, int mid, const struct Runuran_packed *packed);
+/*---------------------------------------------------------------------------*/
+/* Write tables into binary table file.                                      */
+/*---------------------------------------------------------------------------*/
+
+static struct Runuran_table *_table_map (const char *file);
+/*---------------------------------------------------------------------------*/
+/* Map table file into memory and check its contents.                        */
+/*---------------------------------------------------------------------------*/
+
+static void _table_unmap (struct Runuran_table *table);
+/*---------------------------------------------------------------------------*/
+/* Unmap table file.                                                         */
+/*---------------------------------------------------------------------------*/
+
+static const char *_table_check (const struct Runuran_table *table);
+/*---------------------------------------------------------------------------*/
+/* Check contents of mapped table file.                                      */
+/*---------------------------------------------------------------------------*/
+
+static const char *_table_check_tables (int mid, const char *base, const struct table_entry *entry);
+/*---------------------------------------------------------------------------*/
+/* Check contents of tables in mapped table file.                            */
+/*---------------------------------------------------------------------------*/
+
+static double _table_checksum (const struct Runuran_table *table);
+/*---------------------------------------------------------------------------*/
+/* Compute checksum of mapped table file.                                    */
+/*---------------------------------------------------------------------------*/
+
+static void _table_free (SEXP sexp_map);
+/*---------------------------------------------------------------------------*/
+/* Free mapped table file (finalizer for R external pointer).                */
+/*---------------------------------------------------------------------------*/
+
+static SEXP _table_tag (void);
+/*---------------------------------------------------------------------------*/
+/* Make tag for R external pointer to mapped table file.                     */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+
+/* round up to multiple of 8 (alignment of tables) */
+#define ALIGN8(x)  ( ((x) + 7u) & ~((uint64_t) 7u) )
+
+/*****************************************************************************/
+
+SEXP
+Runuran_table_save (SEXP sexp_unur, SEXP sexp_file)
+     /*----------------------------------------------------------------------*/
+     /* Write tables of generator object into binary table file.             */
+     /* The generator object may be packed or unpacked. An unpacked object   */
+     /* is not changed.                                                      */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur ... 'Runuran' object (S4 class)                               */
+     /*   file ... name of table file                                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   R_NilValue                                                         */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_gen, sexp_data, sexp_dom, sexp_tmp;
+  struct unur_gen *gen;
+  struct Runuran_packed packed;
+  const char *file;
+  int mid;
+
+  /* first argument must be S4 class */
+  if (!Rf_isS4(sexp_unur))
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN object");
+
+  /* name of table file */
+  if (!Rf_isString(sexp_file) || Rf_length(sexp_file) != 1)
+    Rf_error("[UNU.RAN - error] argument invalid: 'file' must be a character string");
+  file = R_ExpandFileName(Rf_translateChar(STRING_ELT(sexp_file, 0)));
+
+  /* Extract data list */
+  sexp_data = R_do_slot(sexp_unur, Rf_install("data"));
+
+  if (! Rf_isNull(sexp_data)) {
+    /* object is packed */
+    PROTECT(sexp_tmp = R_NilValue);
+    sexp_dom = R_do_slot(sexp_unur, Rf_install("dom"));
+  }
+
+  else {
+    /* Extract pointer to UNU.RAN generator */
+    sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+    CHECK_UNUR_PTR(sexp_gen);
+    if (Rf_isNull(sexp_gen) || 
+	((gen=R_ExternalPtrAddr(sexp_gen)) == NULL) ) {
+      Rf_errorcall(R_NilValue,"[UNU.RAN - error] broken UNU.RAN object");
+    }
+
+    /* pack tables into temporary R object.              */
+    /* (the generator object itself remains unchanged)    */
+    PROTECT(sexp_tmp = Rf_allocVector(VECSXP, 0));
+    switch (unur_get_method(gen)) {
+    case UNUR_METH_PINV:
+      _Runuran_pack_pinv(gen, sexp_tmp);
+      break;
+    case UNUR_METH_HINV:
+      _Runuran_pack_hinv(gen, sexp_tmp);
+      break;
+    case UNUR_METH_DGT:
+      _Runuran_pack_dgt(gen, sexp_tmp);
+      break;
+    case UNUR_METH_DAU:
+      _Runuran_pack_dau(gen, sexp_tmp);
+      break;
+    default:
+      Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot save tables of UNU.RAN object");
+    }
+    sexp_data = R_do_slot(sexp_tmp, Rf_install("data"));
+    sexp_dom = R_do_slot(sexp_tmp, Rf_install("dom"));
+  }
+
+  /* check method */
+  mid = INTEGER(VECTOR_ELT(sexp_data, 0))[0];
+  if (_table_layout(mid) == NULL)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot save tables of UNU.RAN object");
+
+  /* get tables and write file */
+  _Runuran_get_packed(&packed, sexp_data, sexp_dom);
+  if (_table_write(file, mid, &packed) != UNUR_SUCCESS)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot write table file '%s'", file);
+
+  /* o.k. */
+  UNPROTECT(1);
+  return R_NilValue;
+
+} /* end of Runuran_table_save() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_table_load (SEXP sexp_unur, SEXP sexp_file)
+     /*----------------------------------------------------------------------*/
+     /* Map binary table file into memory and store it in 'unuran' object.   */
+     /* The 'unuran' object then is packed.                                  */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur ... empty 'Runuran' object (S4 class)                         */
+     /*   file ... name of table file                                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   R_NilValue                                                         */
+     /*----------------------------------------------------------------------*/
+{
+  struct Runuran_table *table;
+  const struct table_header *header;
+  const char *file;
+  int i;
+
+  /* names of list entries */
+  SEXP sexp_data_names;
+
+  /* data list and its entries */
+  SEXP sexp_data, sexp_dom, sexp_inversion;
+  SEXP sexp_mid, sexp_map, sexp_size, sexp_checksum;
+
+  /* first argument must be S4 class */
+  if (!Rf_isS4(sexp_unur))
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN object");
+
+  /* name of table file */
+  if (!Rf_isString(sexp_file) || Rf_length(sexp_file) != 1)
+    Rf_error("[UNU.RAN - error] argument invalid: 'file' must be a character string");
+  file = R_ExpandFileName(Rf_translateChar(STRING_ELT(sexp_file, 0)));
+
+  /* map file */
+  table = _table_map(file);
+  header = table->addr;
+
+  /* store pointer to mapped file in R external pointer */
+  PROTECT(sexp_map = R_MakeExternalPtr(table, _table_tag(), R_NilValue));
+  R_RegisterCFinalizer(sexp_map, _table_free);
+
+  /* method ID (int) */
+  PROTECT(sexp_mid = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_mid)[0] = header->mid;
+
+  /* size and checksum of file (double) */
+  /* (used to detect changes when the file is mapped again) */
+  PROTECT(sexp_size = Rf_allocVector(REALSXP, 1));
+  REAL(sexp_size)[0] = (double) table->size;
+  PROTECT(sexp_checksum = Rf_allocVector(REALSXP, 1));
+  REAL(sexp_checksum)[0] = _table_checksum(table);
+
+  /* list of "names" attribute of the objects in our list */
+  PROTECT(sexp_data_names = Rf_allocVector(STRSXP, n_map_slots));
+  for (i=0; i<n_map_slots; i++)
+    SET_STRING_ELT(sexp_data_names, i, Rf_mkChar(slot_name[i]));
+
+  /* create data list */
+  PROTECT(sexp_data = Rf_allocVector(VECSXP, n_map_slots));
+  SET_VECTOR_ELT(sexp_data, pmid,  sexp_mid);       /* attach 'mid' element  */
+  SET_VECTOR_ELT(sexp_data, pfile, sexp_file);      /* attach 'file' element */
+  SET_VECTOR_ELT(sexp_data, pmap,  sexp_map);       /* attach 'map' element  */
+  SET_VECTOR_ELT(sexp_data, psize, sexp_size);      /* attach 'size' element */
+  SET_VECTOR_ELT(sexp_data, pchecksum, sexp_checksum); /* attach 'checksum'  */
+
+  /* attach vector names */
+  Rf_setAttrib(sexp_data, R_NamesSymbol, sexp_data_names);
+
+  /* store in slot 'data' of S4 object 'unur' */
+  R_do_slot_assign(sexp_unur, Rf_install("data"), sexp_data);
+
+  /* set domain of distribution and store in slot 'dom' */
+  PROTECT(sexp_dom = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_dom)[0] = header->dom[0];
+  REAL(sexp_dom)[1] = header->dom[1];
+  R_do_slot_assign(sexp_unur, Rf_install("dom"), sexp_dom);
+
+  /* methods PINV, HINV, and DGT are inversion methods */
+  PROTECT(sexp_inversion = Rf_allocVector(LGLSXP, 1));
+  LOGICAL(sexp_inversion)[0] = (header->mid != (int) UNUR_METH_DAU);
+  R_do_slot_assign(sexp_unur, Rf_install("inversion"), sexp_inversion);
+
+  /* o.k. */
+  UNPROTECT(8);
+  return R_NilValue;
+
+} /* end of Runuran_table_load() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_Runuran_table_is_mapped (SEXP sexp_data)
+     /*----------------------------------------------------------------------*/
+     /* Check whether data list of packed object refers to table file.       */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   data ... data for generation method (R list)                       */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   TRUE if table file is used, FALSE otherwise                        */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_map;
+
+  if (Rf_length(sexp_data) != n_map_slots)
+    return FALSE;
+
+  sexp_map = VECTOR_ELT(sexp_data, pmap);
+  return (TYPEOF(sexp_map) == EXTPTRSXP && R_ExternalPtrTag(sexp_map) == _table_tag());
+
+} /* end of _Runuran_table_is_mapped() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_Runuran_table_get (struct Runuran_packed *packed, SEXP sexp_data)
+     /*----------------------------------------------------------------------*/
+     /* Get tables of packed generator object from mapped table file.        */
+     /* If the 'unuran' object has been restored (e.g., by readRDS()) then   */
+     /* the table file is mapped again. It must have the same method ID,     */
+     /* size and checksum as the file that has been loaded originally.       */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   packed ... pointer to structure for storing tables [output]        */
+     /*   data   ... data for generation method (R list)                     */
+     /*----------------------------------------------------------------------*/
+{
+  struct Runuran_table *table;
+  const struct table_header *header;
+  const struct table_entry *entry;
+  SEXP sexp_map;
+  int i;
+
+  /* pointer to mapped file */
+  sexp_map = VECTOR_ELT(sexp_data, pmap);
+  table = R_ExternalPtrAddr(sexp_map);
+
+  if (table == NULL) {
+    /* object has been restored from a saved R object: map file again */
+    table = _table_map(R_ExpandFileName(Rf_translateChar(STRING_ELT(VECTOR_ELT(sexp_data, pfile), 0))));
+    if (((const struct table_header *) table->addr)->mid != INTEGER(VECTOR_ELT(sexp_data, pmid))[0] ||
+	(double) table->size != REAL(VECTOR_ELT(sexp_data, psize))[0] ||
+	_table_checksum(table) != REAL(VECTOR_ELT(sexp_data, pchecksum))[0]) {
+      _table_unmap(table);
+      Rf_errorcall(R_NilValue,"[UNU.RAN - error] table file has been changed");
+    }
+    R_SetExternalPtrAddr(sexp_map, table);
+    R_RegisterCFinalizer(sexp_map, _table_free);
+  }
+
+  /* get tables */
+  header = table->addr;
+  entry = (const struct table_entry *) (header + 1);
+
+  packed->n_slots = header->n_slots;
+  for (i=0; i<header->n_slots; i++) {
+    packed->table[i] = (const char *) table->addr + entry[i].offset;
+    packed->length[i] = entry[i].length;
+  }
+  packed->dom[0] = header->dom[0];
+  packed->dom[1] = header->dom[1];
+  packed->list = R_NilValue;
+
+} /* end of _Runuran_table_get() */
+
+/*---------------------------------------------------------------------------*/
+
+const char *
+_table_layout (int mid)
+     /*----------------------------------------------------------------------*/
+     /* Get layout of tables for given method.                               */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   mid ... method ID                                                  */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   string with types of tables, or NULL if method is not supported    */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  for (i=0; table_layout[i].layout != NULL; i++)
+    if (table_layout[i].mid == mid)
+      return table_layout[i].layout;
+
+  return NULL;
+
+} /* end of _table_layout() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_table_write (const char *file, int mid, const struct Runuran_packed *packed)
+     /*----------------------------------------------------------------------*/
+     /* Write tables into binary table file.                                 */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   file   ... name of table file                                      */
+     /*   mid    ... method ID                                               */
+     /*   packed ... tables of packed generator object                       */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   UNUR_SUCCESS on success                                            */
+     /*   UNUR_FAILURE otherwise                                             */
+     /*----------------------------------------------------------------------*/
+{
+  struct table_header header;
+  struct table_entry *entry;
+  const char *layout;
+  static const char zeros[8] = {0,0,0,0,0,0,0,0};
+  uint64_t offset;
+  size_t size, tmpsize;
+  char *tmpname;
+  FILE *fp;
+  int i, ok, len;
+#ifndef _WIN32
+  mode_t mask;
+  int fd;
+#endif
+
+  /* check layout of tables */
+  layout = _table_layout(mid);
+  if (layout == NULL || packed->n_slots != (int) strlen(layout))
+    return UNUR_FAILURE;
+
+  /* header */
+  memset(&header, 0, sizeof(struct table_header));
+  strcpy(header.magic, TABLE_MAGIC);
+  header.version = TABLE_VERSION;
+  header.byteorder = TABLE_BYTEORDER;
+  header.mid = mid;
+  header.n_slots = packed->n_slots;
+  header.dom[0] = packed->dom[0];
+  header.dom[1] = packed->dom[1];
+
+  /* entries */
+  entry = (struct table_entry *) R_alloc(packed->n_slots, sizeof(struct table_entry));
+  offset = ALIGN8(sizeof(struct table_header) + packed->n_slots * sizeof(struct table_entry));
+  for (i=0; i<packed->n_slots; i++) {
+    if (packed->table[i] == NULL)
+      return UNUR_FAILURE;
+    entry[i].type = (layout[i] == 'i') ? TABLE_INT : TABLE_REAL;
+    entry[i].length = packed->length[i];
+    entry[i].offset = offset;
+    size = packed->length[i] * ((layout[i] == 'i') ? sizeof(int) : sizeof(double));
+    offset = ALIGN8(offset + size);
+  }
+
+  /* write into temporary file in the same directory.              */
+  /* (the table file must not be truncated in place as it may be    */
+  /* mapped by other R processes; instead the temporary file         */
+  /* replaces the table file when it is complete.)                   */
+  tmpsize = strlen(file) + 32;
+  tmpname = R_alloc(tmpsize, sizeof(char));
+#ifdef _WIN32
+  len = snprintf(tmpname, tmpsize, "%s.%lu.tmp", file, (unsigned long) GetCurrentProcessId());
+#else
+  len = snprintf(tmpname, tmpsize, "%s.XXXXXX", file);
+#endif
+  if (len < 0 || (size_t) len >= tmpsize)
+    /* name of temporary file truncated */
+    return UNUR_FAILURE;
+#ifdef _WIN32
+  fp = fopen(tmpname, "wb");
+#else
+  fd = mkstemp(tmpname);
+  if (fd < 0)
+    return UNUR_FAILURE;
+  /* mkstemp() creates the file with mode 0600 */
+  mask = umask(0); umask(mask);
+  fchmod(fd, 0666 & ~mask);
+  fp = fdopen(fd, "wb");
+  if (fp == NULL) {
+    close(fd);
+    remove(tmpname);
+  }
+#endif
+  if (fp == NULL)
+    return UNUR_FAILURE;
+
+  ok = (fwrite(&header, sizeof(struct table_header), 1, fp) == 1);
+  ok = ok && (fwrite(entry, sizeof(struct table_entry), packed->n_slots, fp) == (size_t) packed->n_slots);
+  offset = sizeof(struct table_header) + packed->n_slots * sizeof(struct table_entry);
+  for (i=0; ok && i<packed->n_slots; i++) {
+    /* padding */
+    ok = (fwrite(zeros, 1, entry[i].offset - offset, fp) == entry[i].offset - offset);
+    /* table */
+    size = packed->length[i] * ((layout[i] == 'i') ? sizeof(int) : sizeof(double));
+    ok = ok && (fwrite(packed->table[i], 1, size, fp) == size);
+    offset = entry[i].offset + size;
+  }
+
+  if (fflush(fp) != 0) ok = FALSE;
+  if (fclose(fp) != 0) ok = FALSE;
+
+  /* replace table file */
+#ifdef _WIN32
+  ok = ok && MoveFileExA(tmpname, file, MOVEFILE_REPLACE_EXISTING);
+#else
+  ok = ok && (rename(tmpname, file) == 0);
+#endif
+  if (!ok)
+    remove(tmpname);
+
+  return (ok) ? UNUR_SUCCESS : UNUR_FAILURE;
+
+} /* end of _table_write() */
+
+/*---------------------------------------------------------------------------*/
+
+struct Runuran_table *
+_table_map (const char *file)
+     /*----------------------------------------------------------------------*/
+     /* Map table file read-only into memory and check its contents.         */
+     /* An R error is thrown if this fails.                                  */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   file ... name of table file                                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   pointer to mapped table file                                       */
+     /*----------------------------------------------------------------------*/
+{
+  struct Runuran_table *table;
+  const char *msg;
+  void *addr;
+  size_t size;
+
+#ifdef _WIN32
+  HANDLE hfile, hmap;
+  LARGE_INTEGER fsize;
+
+  hfile = CreateFileA(file, GENERIC_READ, FILE_SHARE_READ, NULL,
+		      OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (hfile == INVALID_HANDLE_VALUE)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot open table file '%s'", file);
+  if (!GetFileSizeEx(hfile, &fsize) || fsize.QuadPart < (LONGLONG) sizeof(struct table_header)) {
+    CloseHandle(hfile);
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid table file '%s'", file);
+  }
+  size = (size_t) fsize.QuadPart;
+  hmap = CreateFileMappingA(hfile, NULL, PAGE_READONLY, 0, 0, NULL);
+  CloseHandle(hfile);
+  addr = (hmap == NULL) ? NULL : MapViewOfFile(hmap, FILE_MAP_READ, 0, 0, 0);
+  if (hmap != NULL) CloseHandle(hmap);
+  if (addr == NULL)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot map table file '%s'", file);
+
+#else
+  int fd;
+  struct stat st;
+
+  fd = open(file, O_RDONLY);
+  if (fd < 0)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot open table file '%s'", file);
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(struct table_header)) {
+    close(fd);
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid table file '%s'", file);
+  }
+  size = (size_t) st.st_size;
+  addr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (addr == MAP_FAILED)
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot map table file '%s'", file);
+#endif
+
+  table = R_Calloc(1, struct Runuran_table);
+  table->addr = addr;
+  table->size = size;
+
+  /* check contents */
+  msg = _table_check(table);
+  if (msg != NULL) {
+    _table_unmap(table);
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] invalid table file '%s': %s", file, msg);
+  }
+
+  return table;
+
+} /* end of _table_map() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_table_unmap (struct Runuran_table *table)
+     /*----------------------------------------------------------------------*/
+     /* Unmap table file.                                                    */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   table ... pointer to mapped table file                             */
+     /*----------------------------------------------------------------------*/
+{
+#ifdef _WIN32
+  UnmapViewOfFile(table->addr);
+#else
+  munmap(table->addr, table->size);
+#endif
+  R_Free(table);
+} /* end of _table_unmap() */
+
+/*---------------------------------------------------------------------------*/
+
+const char *
+_table_check (const struct Runuran_table *table)
+     /*----------------------------------------------------------------------*/
+     /* Check contents of mapped table file.                                 */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   table ... pointer to mapped table file                             */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   NULL if file is o.k., error message otherwise                      */
+     /*----------------------------------------------------------------------*/
+{
+  const struct table_header *header = table->addr;
+  const struct table_entry *entry;
+  const char *layout;
+  uint64_t size;
+  int i;
+
+  /* header */
+  if (strncmp(header->magic, TABLE_MAGIC, sizeof(header->magic)) != 0)
+    return "not a UNU.RAN table file";
+  if (header->byteorder != TABLE_BYTEORDER)
+    return "wrong byte order";
+  if (header->version != TABLE_VERSION)
+    return "unsupported version";
+
+  /* method */
+  layout = _table_layout(header->mid);
+  if (layout == NULL || header->n_slots != (int) strlen(layout))
+    return "unsupported method";
+
+  /* entries */
+  if (sizeof(struct table_header) + header->n_slots * sizeof(struct table_entry) > table->size)
+    return "file truncated";
+  entry = (const struct table_entry *) (header + 1);
+
+  for (i=0; i<header->n_slots; i++) {
+    if (entry[i].type != ((layout[i] == 'i') ? TABLE_INT : TABLE_REAL) ||
+	entry[i].length < 1 || entry[i].offset % 8 != 0)
+      return "invalid table";
+    size = (uint64_t) entry[i].length * ((entry[i].type == TABLE_INT) ? sizeof(int) : sizeof(double));
+    if (entry[i].offset > table->size || size > table->size - entry[i].offset)
+      return "file truncated";
+  }
+
+  /* tables */
+  return _table_check_tables(header->mid, (const char *) table->addr, entry);
+
+} /* end of _table_check() */
+
+/*---------------------------------------------------------------------------*/
+
+/* tables in mapped file */
+#define TAB_INT(p)   ((const int *) (base + entry[(p)].offset))
+#define TAB_REAL(p)  ((const double *) (base + entry[(p)].offset))
+#define TAB_LEN(p)   (entry[(p)].length)
+
+const char *
+_table_check_tables (int mid, const char *base, const struct table_entry *entry)
+     /*----------------------------------------------------------------------*/
+     /* Check contents of tables in mapped table file.                       */
+     /* All indices in int tables must point into the tables they index.     */
+     /* Otherwise sampling would read beyond the end of the mapped file.     */
+     /* [ Positions of tables MUST match the layouts in 'table_layout' ! ]   */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   mid   ... method ID                                                */
+     /*   base  ... start of mapped table file                               */
+     /*   entry ... entries for tables                                       */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   NULL if tables are o.k., error message otherwise                   */
+     /*----------------------------------------------------------------------*/
+{
+  const int *guide, *jx;
+  const double *iv;
+  int order, width, n_ivs, len;
+  int i;
+
+  switch (mid) {
+
+  case UNUR_METH_PINV:
+    /* mid, order, Umax, guide, iv */
+    if (TAB_LEN(1) != 1 || TAB_LEN(2) != 1)
+      return "invalid table";
+    order = TAB_INT(1)[0];
+    if (order < 3 || order > 17)
+      return "invalid order of polynomial";
+    /* each interval: cdfi, 2*order-1 coefficients, xi; plus right boundary */
+    width = 2*order + 1;
+    if (TAB_LEN(4) % width != 0 || (n_ivs = TAB_LEN(4) / width - 1) < 1)
+      return "number of intervals does not match order";
+    guide = TAB_INT(3);
+    for (i=0; i<TAB_LEN(3); i++)
+      if (guide[i] < 0 || guide[i] % width != 0 || guide[i] / width >= n_ivs)
+	return "guide table out of range";
+    /* search for interval must stop at right boundary */
+    iv = TAB_REAL(4);
+    if (! (iv[n_ivs*width] >= TAB_REAL(2)[0]))
+      return "invalid table of intervals";
+    break;
+
+  case UNUR_METH_HINV:
+    /* mid, order, Urange, trunc, guide, iv */
+    if (TAB_LEN(1) != 1 || TAB_LEN(2) != 2 || TAB_LEN(3) != 2)
+      return "invalid table";
+    order = TAB_INT(1)[0];
+    if (order != 1 && order != 3 && order != 5)
+      return "invalid order of polynomial";
+    /* each interval: u-value, order+1 coefficients; last entry is boundary */
+    width = order + 2;
+    if (TAB_LEN(5) % width != 0 || (n_ivs = TAB_LEN(5) / width - 1) < 1)
+      return "number of intervals does not match order";
+    guide = TAB_INT(4);
+    for (i=0; i<TAB_LEN(4); i++)
+      if (guide[i] < 0 || guide[i] % width != 0 || guide[i] / width >= n_ivs)
+	return "guide table out of range";
+    /* search for interval must stop at right boundary */
+    iv = TAB_REAL(5);
+    if (! (iv[n_ivs*width] >= TAB_REAL(2)[1]))
+      return "invalid table of intervals";
+    break;
+
+  case UNUR_METH_DGT:
+    /* mid, lb, sum, guide, cumpv */
+    if (TAB_LEN(1) != 1 || TAB_LEN(2) != 1)
+      return "invalid table";
+    guide = TAB_INT(3);
+    for (i=0; i<TAB_LEN(3); i++)
+      if (guide[i] < 0 || guide[i] >= TAB_LEN(4))
+	return "guide table out of range";
+    /* search must stop at last entry */
+    if (! (TAB_REAL(4)[TAB_LEN(4)-1] >= TAB_REAL(2)[0]))
+      return "invalid table of cumulated probabilities";
+    break;
+
+  case UNUR_METH_DAU:
+    /* mid, lb, len, qx, jx */
+    if (TAB_LEN(1) != 1 || TAB_LEN(2) != 1)
+      return "invalid table";
+    /* urn: qx and jx have the same size which is at least len */
+    len = TAB_INT(2)[0];
+    if (TAB_LEN(3) != TAB_LEN(4) || len < 1 || len > TAB_LEN(4))
+      return "size of urn does not match length of probability vector";
+    jx = TAB_INT(4);
+    for (i=0; i<TAB_LEN(4); i++)
+      if (jx[i] < 0 || jx[i] >= len)
+	return "aliases out of range";
+    break;
+
+  default:
+    return "unsupported method";
+  }
+
+  /* o.k. */
+  return NULL;
+
+} /* end of _table_check_tables() */
+
+#undef TAB_INT
+#undef TAB_REAL
+#undef TAB_LEN
+
+/*---------------------------------------------------------------------------*/
+
+double
+_table_checksum (const struct Runuran_table *table)
+     /*----------------------------------------------------------------------*/
+     /* Compute checksum of mapped table file (32 bit FNV-1a hash).          */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   table ... pointer to mapped table file                             */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   checksum (stored as double in R data list)                         */
+     /*----------------------------------------------------------------------*/
+{
+  const unsigned char *byte = table->addr;
+  uint32_t hash = 2166136261u;
+  size_t i;
+
+  for (i=0; i<table->size; i++) {
+    hash ^= byte[i];
+    hash *= 16777619u;
+  }
+
+  return (double) hash;
+
+} /* end of _table_checksum() */
+
+/*---------------------------------------------------------------------------*/
+
+void
+_table_free (SEXP sexp_map)
+     /*----------------------------------------------------------------------*/
+     /* Free mapped table file.                                              */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   map ... R external pointer to mapped table file                    */
+     /*----------------------------------------------------------------------*/
+{
+  struct Runuran_table *table;
+
+  table = R_ExternalPtrAddr(sexp_map);
+  if (table != NULL)
+    _table_unmap(table);
+
+  R_ClearExternalPtr(sexp_map);
+
+} /* end of _table_free() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_table_tag (void)
+     /*----------------------------------------------------------------------*/
+     /* Make tag for R external pointer to mapped table file.                */
+     /*                                                                      */
+     /* Parameters: none                                                     */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   tag (R object)                                                     */
+     /*----------------------------------------------------------------------*/
+{
+  static SEXP tag = NULL;
+
+  /* make tag for R object */
+  if (!tag) tag = Rf_install("R_UNURAN_TABLE_TAG");
+
+  return tag;
+} /* end of _table_tag() */
+
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,531 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_tdr.c                                                    *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         R interface for UNU.RAN -- TDR                                   *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************/
+
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+#include <methods/tdr_struct.h>
+
+/*---------------------------------------------------------------------------*/
+
+/* number of entries (slots) in data list */
+#define n_slots (8)
+
+/* names of slots */
+static const char *slot_name[n_slots] = {"mid","variant","Urange","Atotal","guide","iv","pdf","islog"};
+
+/* positions in data list */
+enum {
+  pmid = 0,      /* method ID [ This MUST be 0 ! ] */
+  pvariant = 1,  /* variant of TDR (transformation and sampling method) */
+  pUrange = 2,   /* Umin and Umax */
+  pAtotal = 3,   /* total area below hat */
+  pguide = 4,    /* guide table */
+  piv = 5,       /* table of (frozen) intervals */
+  ppdf = 6,      /* PDF of distribution (R function) */
+  pislog = 7     /* whether 'pdf' is the logarithm of the PDF */
+};
+
+/* number of entries per interval in table 'iv' */
+#define n_ivdata (8)
+
+/* positions of entries for an interval in table 'iv' */
+enum {
+  ix = 0,        /* construction point */
+  ifx = 1,       /* value of PDF at construction point */
+  iTfx = 2,      /* value of transformed PDF at construction point */
+  idTfx = 3,     /* derivative of transformed PDF at construction point */
+  isq = 4,       /* ratio of area below squeeze and area below hat */
+  iAcum = 5,     /* cumulated area of intervals */
+  iAhat = 6,     /* area below hat */
+  iAhatr = 7     /* area below hat on right hand side */
+};
+
+/* variants of method TDR (copied from 'tdr.c') */
+#define TDR_VARMASK_T          0x000fu   /* indicates transformation           */
+#define TDR_VAR_T_SQRT         0x0001u   /* T(x) = -1/sqrt(x)                  */
+#define TDR_VAR_T_LOG          0x0002u   /* T(x) = log(x)                      */
+#define TDR_VARMASK_VARIANT    0x00f0u   /* indicates which variant            */
+#define TDR_VARIANT_PS         0x0020u   /* use proportional squeeze           */
+#define TDR_VARIANT_IA         0x0030u   /* use immediate acceptance           */
+#define TDR_VARFLAG_VERIFY     0x0100u   /* flag for verifying mode            */
+
+/*---------------------------------------------------------------------------*/
+
+static double _tdr_eval_hatinv (double U, const double *iv, unsigned variant);
+/*---------------------------------------------------------------------------*/
+/* Evaluate inverse of hat function in interval.                             */
+/*---------------------------------------------------------------------------*/
+
+static double _tdr_eval_hat (double X, const double *iv, unsigned variant);
+/*---------------------------------------------------------------------------*/
+/* Evaluate hat function in interval.                                        */
+/*---------------------------------------------------------------------------*/
+
+static double _tdr_eval_pdf (double X, SEXP sexp_pdf, int islog, SEXP sexp_arg);
+/*---------------------------------------------------------------------------*/
+/* Evaluate PDF of distribution.                                             */
+/*---------------------------------------------------------------------------*/
+
+/*---------------------------------------------------------------------------*/
+
+#define GEN    ((struct unur_tdr_gen*)gen->datap)
+/* data for generator object */
+
+#define DISTR  (gen->distr->data.cont)
+/* data for distribution in generator object */
+
+/*****************************************************************************/
+
+void
+_Runuran_pack_tdr (struct unur_gen *gen, SEXP sexp_unur)
+     /*----------------------------------------------------------------------*/
+     /* Pack Runuran generator object for method TDR into R list             */
+     /*                                                                      */
+     /* The hat function is frozen (see unur_tdr_freeze_hat()) and stored    */
+     /* as table of intervals. However, the PDF of the distribution is still */
+     /* required for the rejection step. Thus packing is only possible if    */
+     /* the PDF is given as R function and variant PS or IA is used.         */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen  ... pointer to UNU.RAN generator object                       */
+     /*   unur ... 'Runuran' object (S4 class)                               */
+     /*----------------------------------------------------------------------*/
+{
+  int i, n_iv, islog;
+  struct unur_tdr_interval *iv;
+  double *fiv;
+
+  /* names of list entries */
+  SEXP sexp_data_names;
+
+  /* data list and its entries */
+  SEXP sexp_data, sexp_dom;
+  SEXP sexp_mid, sexp_variant, sexp_Urange, sexp_Atotal, sexp_guide, sexp_iv;
+  SEXP sexp_pdf, sexp_islog;
+
+  /* check variant: frozen hat requires PS or IA with T = log or T = -1/sqrt */
+  if ( ! ((gen->variant & TDR_VARMASK_VARIANT) == TDR_VARIANT_PS ||
+	  (gen->variant & TDR_VARMASK_VARIANT) == TDR_VARIANT_IA) ||
+       ! ((gen->variant & TDR_VARMASK_T) == TDR_VAR_T_LOG ||
+	  (gen->variant & TDR_VARMASK_T) == TDR_VAR_T_SQRT) )
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot pack UNU.RAN object: TDR variant must be 'PS' or 'IA' with c=0 or c=-0.5");
+
+  /* PDF must be given as R function */
+  sexp_pdf = _Runuran_cont_get_pdf(gen->distr, &islog);
+  if (Rf_isNull(sexp_pdf))
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot pack UNU.RAN object: TDR requires PDF given as R function");
+
+  /* freeze hat function */
+  if (GEN->fiv == NULL) {
+    if (unur_tdr_freeze_hat(gen) != UNUR_SUCCESS || GEN->fiv == NULL)
+      Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot pack UNU.RAN object");
+  }
+
+  /* create entries for data list */
+
+  /* method ID (int) */
+  PROTECT(sexp_mid = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_mid)[0] = UNUR_METH_TDR;
+
+  /* variant (int) */
+  PROTECT(sexp_variant = Rf_allocVector(INTSXP, 1));
+  INTEGER(sexp_variant)[0] = (int) (gen->variant & (TDR_VARMASK_T | TDR_VARMASK_VARIANT));
+
+  /* Umin and Umax (double[2]) */
+  PROTECT(sexp_Urange = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_Urange)[0] = GEN->Umin;
+  REAL(sexp_Urange)[1] = GEN->Umax;
+
+  /* total area below hat (double) */
+  PROTECT(sexp_Atotal = Rf_allocVector(REALSXP, 1));
+  REAL(sexp_Atotal)[0] = GEN->Atotal;
+
+  /* guide table (int[]) */
+  /* (entries are indices of intervals) */
+  PROTECT(sexp_guide = Rf_allocVector(INTSXP, GEN->guide_size));
+  memcpy(INTEGER(sexp_guide), GEN->fguide, GEN->guide_size * sizeof(int));
+
+  /* table of intervals (same as in frozen hat) */
+  for (n_iv=0, iv=GEN->iv; iv != NULL; iv = iv->next)
+    ++n_iv;
+  PROTECT(sexp_iv = Rf_allocVector(REALSXP, n_iv * n_ivdata));
+  for (i=0; i<n_iv; i++) {
+    fiv = REAL(sexp_iv) + i * n_ivdata;
+    fiv[ix]     = GEN->fiv[i].x;
+    fiv[ifx]    = GEN->fiv[i].fx;
+    fiv[iTfx]   = GEN->fiv[i].Tfx;
+    fiv[idTfx]  = GEN->fiv[i].dTfx;
+    fiv[isq]    = GEN->fiv[i].sq;
+    fiv[iAcum]  = GEN->fiv[i].Acum;
+    fiv[iAhat]  = GEN->fiv[i].Ahat;
+    fiv[iAhatr] = GEN->fiv[i].Ahatr;
+  }
+
+  /* whether 'pdf' is logarithm of PDF (logical) */
+  PROTECT(sexp_islog = Rf_allocVector(LGLSXP, 1));
+  LOGICAL(sexp_islog)[0] = islog;
+
+  /* list of "names" attribute of the objects in our list */
+  PROTECT(sexp_data_names = Rf_allocVector(STRSXP, n_slots));
+  for (i=0; i<n_slots; i++)
+    SET_STRING_ELT(sexp_data_names, i, Rf_mkChar(slot_name[i]));
+
+  /* create data list */
+  PROTECT(sexp_data = Rf_allocVector(VECSXP, n_slots));
+  SET_VECTOR_ELT(sexp_data, pmid,     sexp_mid);      /* attach 'mid' element     */
+  SET_VECTOR_ELT(sexp_data, pvariant, sexp_variant);  /* attach 'variant' element */
+  SET_VECTOR_ELT(sexp_data, pUrange,  sexp_Urange);   /* attach 'Urange' element  */
+  SET_VECTOR_ELT(sexp_data, pAtotal,  sexp_Atotal);   /* attach 'Atotal' element  */
+  SET_VECTOR_ELT(sexp_data, pguide,   sexp_guide);    /* attach 'guide' element   */
+  SET_VECTOR_ELT(sexp_data, piv,      sexp_iv);       /* attach 'iv' element      */
+  SET_VECTOR_ELT(sexp_data, ppdf,     sexp_pdf);      /* attach 'pdf' element     */
+  SET_VECTOR_ELT(sexp_data, pislog,   sexp_islog);    /* attach 'islog' element   */
+
+  /* attach vector names */
+  Rf_setAttrib(sexp_data, R_NamesSymbol, sexp_data_names);
+
+  /* store in slot 'data' of S4 object 'unur' */
+  R_do_slot_assign(sexp_unur, Rf_install("data"), sexp_data);
+
+  /* set domain of distribution and store in slot 'dom' */
+  PROTECT(sexp_dom = Rf_allocVector(REALSXP, 2));
+  REAL(sexp_dom)[0] = DISTR.domain[0];
+  REAL(sexp_dom)[1] = DISTR.domain[1];
+  R_do_slot_assign(sexp_unur, Rf_install("dom"), sexp_dom);
+
+  /* o.k. */
+  UNPROTECT(10);
+  return;
+
+} /* end of _Runuran_pack_tdr() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_sample_tdr (const struct Runuran_packed *data, int n)
+     /*----------------------------------------------------------------------*/
+     /* Sample from generator object: use R data list (packed object)        */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   data ... tables of packed generator object                         */
+     /*   n    ... sample size (positive integer)                            */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   random sample of size 'n'                                          */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+  const double *iv;
+  double U, V, X, hx;
+  double *res;
+  SEXP sexp_res = R_NilValue;
+  SEXP sexp_arg;
+
+  /* extract data */
+  unsigned variant = (unsigned) PACKED_INT(data, pvariant)[0];
+  double Umin = PACKED_REAL(data, pUrange)[0];
+  double Umax = PACKED_REAL(data, pUrange)[1];
+  double Atotal = PACKED_REAL(data, pAtotal)[0];
+  const int *guide = PACKED_INT(data, pguide);
+  int guide_size = PACKED_LENGTH(data, pguide);
+  const double *fiv = PACKED_REAL(data, piv);
+  SEXP sexp_pdf = VECTOR_ELT(data->list, ppdf);
+  int islog = PACKED_INT(data, pislog)[0];
+
+  /* argument for calling PDF */
+  PROTECT(sexp_arg = Rf_allocVector(REALSXP, 1));
+
+  /* generate sample */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+
+  /* FIXME: R built-in URNG hard coded ! */
+
+  if ((variant & TDR_VARMASK_VARIANT) == TDR_VARIANT_IA) {
+    /* variant IA: immediate acceptance */
+    for (i=0; i<n; i++) {
+      while (1) {
+	/* find interval */
+	U = unif_rand();
+	iv = fiv + n_ivdata * guide[(int) (U * guide_size)];
+	U *= Atotal;
+	while (iv[iAcum] < U)
+	  iv += n_ivdata;
+
+	/* immediate acceptance below squeeze */
+	U -= iv[iAcum];
+	if (U >= - iv[isq] * iv[iAhat]) {
+	  X = _tdr_eval_hatinv (U / iv[isq] + iv[iAhatr], iv, variant);
+	  break;
+	}
+
+	/* else: rejection from region between hat and squeeze */
+	U = (U + iv[isq] * iv[iAhat]) / (1. - iv[isq]);
+	X = _tdr_eval_hatinv (U + iv[iAhatr], iv, variant);
+	hx = _tdr_eval_hat (X, iv, variant);
+	V = (iv[isq] + (1. - iv[isq]) * unif_rand()) * hx;
+	if (V <= _tdr_eval_pdf (X, sexp_pdf, islog, sexp_arg))
+	  break;
+      }
+      res[i] = X;
+    }
+  }
+
+  else {
+    /* variant PS: proportional squeeze */
+    for (i=0; i<n; i++) {
+      while (1) {
+	/* find interval */
+	U = Umin + unif_rand() * (Umax - Umin);
+	iv = fiv + n_ivdata * guide[(int) (U * guide_size)];
+	U *= Atotal;
+	while (iv[iAcum] < U)
+	  iv += n_ivdata;
+
+	/* generate point from hat distribution */
+	U -= iv[iAcum] - iv[iAhatr];
+	X = _tdr_eval_hatinv (U, iv, variant);
+
+	/* accept or reject */
+	V = unif_rand();
+	if (V <= iv[isq])
+	  break;
+	V *= _tdr_eval_hat (X, iv, variant);
+	if (V <= _tdr_eval_pdf (X, sexp_pdf, islog, sexp_arg))
+	  break;
+      }
+      res[i] = X;
+    }
+  }
+
+  /* return result to R */
+  UNPROTECT(2);
+  return sexp_res;
+
+} /* end of _Runuran_sample_tdr() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_tdr_frozen (SEXP sexp_unur, SEXP sexp_op, SEXP sexp_n)
+     /*----------------------------------------------------------------------*/
+     /* Internal function for testing the frozen hat of method TDR           */
+     /* (see unur_tdr_freeze_hat()).                                         */
+     /*                                                                      */
+     /* Operations:                                                          */
+     /*   "status" ... whether the hat is frozen                             */
+     /*   "freeze" ... freeze hat; returns whether the hat is frozen         */
+     /*   "reinit" ... reinitialize generator; returns whether the hat is    */
+     /*                frozen                                                */
+     /*   "clone"  ... draw sample of size 'n' from a clone of the object    */
+     /*   "list"   ... draw sample of size 'n' from the linked list of       */
+     /*                intervals instead of the frozen copy                  */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur ... 'Runuran' object (S4 class)                               */
+     /*   op   ... operation (string)                                        */
+     /*   n    ... sample size (positive integer)                            */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   logical or random sample of size 'n'                               */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_gen;
+  SEXP sexp_res = R_NilValue;
+  struct unur_gen *gen, *clone;
+  struct unur_tdr_frozen *fiv;
+  int *fguide;
+  const char *op;
+  int n, verify;
+
+  /* first argument must be S4 class */
+  if (!Rf_isS4(sexp_unur))
+    Rf_error("[UNU.RAN - error] argument invalid: 'unr' must be UNU.RAN object");
+
+  /* Extract pointer to UNU.RAN generator */
+  sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+  CHECK_UNUR_PTR(sexp_gen);
+  if (Rf_isNull(sexp_gen) || 
+      ((gen=R_ExternalPtrAddr(sexp_gen)) == NULL) ) {
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] broken or packed UNU.RAN object");
+  }
+  if (unur_get_method(gen) != UNUR_METH_TDR) {
+    Rf_errorcall(R_NilValue,"[UNU.RAN - error] method TDR required");
+  }
+
+  /* Extract operation and sample size */
+  if (! (Rf_isString(sexp_op) && Rf_length(sexp_op) == 1))
+    Rf_error("[UNU.RAN - error] argument invalid: 'op' must be string");
+  op = CHAR(STRING_ELT(sexp_op, 0));
+  n = *(INTEGER (Rf_coerceVector(sexp_n, INTSXP)));
+
+  if (!strcmp(op, "status") || !strcmp(op, "freeze") || !strcmp(op, "reinit")) {
+    if (!strcmp(op, "freeze") && unur_tdr_freeze_hat(gen) != UNUR_SUCCESS)
+      Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot freeze hat");
+    if (!strcmp(op, "reinit") && unur_reinit(gen) != UNUR_SUCCESS)
+      Rf_errorcall(R_NilValue,"[UNU.RAN - error] cannot reinitialize generator");
+    return Rf_ScalarLogical( (GEN->fiv != NULL) ? TRUE : FALSE );
+  }
+
+  if (n == NA_INTEGER || n <= 0)
+    Rf_error("sample size 'n' must be positive integer");
+
+  if (!strcmp(op, "clone")) {
+    clone = unur_gen_clone(gen);
+    if (clone == NULL)
+      Rf_error("[UNU.RAN - error] cannot clone UNU.RAN object");
+    PROTECT(sexp_res = _Runuran_sample_unur(clone, n));
+    unur_free(clone);
+    UNPROTECT(1);
+    return sexp_res;
+  }
+
+  if (!strcmp(op, "list")) {
+    /* hide frozen copy: sampling routines then follow the linked list */
+    fiv = GEN->fiv;  fguide = GEN->fguide;
+    verify = (gen->variant & TDR_VARFLAG_VERIFY) ? TRUE : FALSE;
+    GEN->fiv = NULL;  GEN->fguide = NULL;
+    unur_tdr_chg_verify(gen, FALSE);
+    PROTECT(sexp_res = _Runuran_sample_unur(gen, n));
+    GEN->fiv = fiv;  GEN->fguide = fguide;
+    unur_tdr_chg_verify(gen, verify);
+    UNPROTECT(1);
+    return sexp_res;
+  }
+
+  Rf_error("[UNU.RAN - error] argument invalid: unknown operation '%s'", op);
+  return R_NilValue;
+
+} /* end of Runuran_tdr_frozen() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_tdr_eval_hatinv (double U, const double *iv, unsigned variant)
+     /*----------------------------------------------------------------------*/
+     /* Evaluate inverse of hat function in interval.                        */
+     /* (Same as in _unur_tdr_ps_sample_frozen().)                           */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   U       ... area below hat right of construction point             */
+     /*   iv      ... data for interval                                      */
+     /*   variant ... variant of TDR                                         */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   point X in interval                                                */
+     /*----------------------------------------------------------------------*/
+{
+  double t;
+
+  if (_unur_iszero(iv[idTfx]))
+    return (iv[ix] + U / iv[ifx]);
+
+  if ((variant & TDR_VARMASK_T) == TDR_VAR_T_LOG) {
+    t = iv[idTfx] * U / iv[ifx];
+    if (fabs(t) > 1.e-6)
+      return (iv[ix] + log(t + 1.) * U / (iv[ifx] * t));
+    else if (fabs(t) > 1.e-8)
+      return (iv[ix] + U / iv[ifx] * (1 - t/2. + t*t/3.));
+    else
+      return (iv[ix] + U / iv[ifx] * (1 - t/2.));
+  }
+
+  else { /* TDR_VAR_T_SQRT */
+    return (iv[ix] + (iv[iTfx]*iv[iTfx]*U) / (1.-iv[iTfx]*iv[idTfx]*U));
+  }
+
+} /* end of _tdr_eval_hatinv() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_tdr_eval_hat (double X, const double *iv, unsigned variant)
+     /*----------------------------------------------------------------------*/
+     /* Evaluate hat function in interval.                                   */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   X       ... point in interval                                      */
+     /*   iv      ... data for interval                                      */
+     /*   variant ... variant of TDR                                         */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   value of hat function at X                                         */
+     /*----------------------------------------------------------------------*/
+{
+  double Thx;
+
+  if ((variant & TDR_VARMASK_T) == TDR_VAR_T_LOG)
+    return (iv[ifx] * exp(iv[idTfx]*(X - iv[ix])));
+
+  else { /* TDR_VAR_T_SQRT */
+    Thx = iv[iTfx] + iv[idTfx] * (X - iv[ix]);
+    return (1./(Thx*Thx));
+  }
+
+} /* end of _tdr_eval_hat() */
+
+/*---------------------------------------------------------------------------*/
+
+double
+_tdr_eval_pdf (double X, SEXP sexp_pdf, int islog, SEXP sexp_arg)
+     /*----------------------------------------------------------------------*/
+     /* Evaluate PDF of distribution.                                        */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   X     ... argument                                                 */
+     /*   pdf   ... PDF or logPDF (R function)                               */
+     /*   islog ... TRUE if 'pdf' is logarithm of PDF                        */
+     /*   arg   ... (protected) R vector of length 1 for argument            */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   PDF at X                                                           */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP R_fcall;
+  double fx;
+
+  REAL(sexp_arg)[0] = X;
+  PROTECT(R_fcall = Rf_lang2(sexp_pdf, sexp_arg));
+  fx = REAL(Rf_eval(R_fcall, R_GlobalEnv))[0];
+  UNPROTECT(1);
+
+  return ((islog) ? exp(fx) : fx);
+
+} /* end of _tdr_eval_pdf() */
+
+/*---------------------------------------------------------------------------*/
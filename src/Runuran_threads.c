@@ -0,0 +1,263 @@
+/*****************************************************************************
+ *                                                                           *
+ *          UNU.RAN -- Universal Non-Uniform Random number generator         *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   FILE: Runuran_threads.c                                                 *
+ *                                                                           *
+ *   PURPOSE:                                                                *
+ *         Sample from UNU.RAN generator objects using several threads.      *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   Copyright (c) 2024 Wolfgang Hoermann and Josef Leydold                  *
+ *   Dept. for Statistics, University of Economics, Vienna, Austria          *
+ *                                                                           *
+ *   This program is free software; you can redistribute it and/or modify    *
+ *   it under the terms of the GNU General Public License as published by    *
+ *   the Free Software Foundation; either version 2 of the License, or       *
+ *   (at your option) any later version.                                     *
+ *                                                                           *
+ *   This program is distributed in the hope that it will be useful,         *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of          *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ *   GNU General Public License for more details.                            *
+ *                                                                           *
+ *   You should have received a copy of the GNU General Public License       *
+ *   along with this program; if not, write to the                           *
+ *   Free Software Foundation, Inc.,                                         *
+ *   59 Temple Place, Suite 330, Boston, MA 02111-1307, USA                  *
+ *                                                                           *
+ *****************************************************************************
+ *                                                                           *
+ *   The sample is split into chunks of RUNURAN_THREAD_CHUNK variates.       *
+ *   Chunk 'j' is generated by a clone of the generator object that uses     *
+ *   stream 'j' of a Philox4x32-10 counter-based URNG. The key of this URNG  *
+ *   is drawn from the native URNG of the generator object if it has one     *
+ *   and from the R built-in URNG otherwise. Thus the sample is              *
+ *   reproducible for a given seed (and for a given number of threads in     *
+ *   case of methods that adapt their tables during sampling).               *
+ *                                                                           *
+ *   Methods with adaptive rejection (AROU, ARS, TABL, TDR) do not use       *
+ *   clones. Instead all threads share the hat of the given generator        *
+ *   object (see unur_gen_share()) which is not modified during sampling.    *
+ *   Construction points for refining the hat are collected by each thread   *
+ *   and added to the hat after all threads have finished                    *
+ *   (see unur_gen_share_merge()).                                           *
+ *                                                                           *
+ *****************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+
+#include "Runuran.h"
+
+/* internal header files for UNU.RAN */
+#include <unur_source.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/*---------------------------------------------------------------------------*/
+
+static int _Runuran_is_threadsafe (const struct unur_gen *gen);
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+_Runuran_sample_unur_threads (struct unur_gen *gen, int n, int threads)
+     /*----------------------------------------------------------------------*/
+     /* Sample from generator object using several threads.                  */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen     ... pointer to UNU.RAN generator object                    */
+     /*   n       ... sample size (positive integer)                         */
+     /*   threads ... number of threads (positive integer)                   */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   random sample of size 'n'                                          */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_res = R_NilValue;
+  double *res;
+  struct unur_gen **clone;     /* generator object for each thread */
+  int is_shared;               /* whether threads share hat of 'gen' */
+  UNUR_URNG **urng;            /* uniform random number generators */
+  int *K = NULL;               /* buffer for discrete distributions */
+  int is_discr;                /* whether distribution is discrete */
+  UNUR_URNG *urng0;            /* URNG of generator object */
+  unsigned long seed;          /* seed for URNG streams */
+  int n_chunks;                /* number of chunks */
+  int old_level;               /* level of error handler */
+  int t, j;
+
+  /* check distribution type */
+  switch (unur_distr_get_type(unur_get_distr(gen))) {
+  case UNUR_DISTR_CONT:   /* univariate continuous distribution */
+  case UNUR_DISTR_CEMP:   /* empirical continuous univariate distribution */
+    is_discr = FALSE;
+    break;
+  case UNUR_DISTR_DISCR:  /* discrete univariate distribution */
+    is_discr = TRUE;
+    break;
+  default:
+    Rf_error("[UNU.RAN - error] '%s': 'threads' requires univariate distribution",
+	     unur_distr_get_name(unur_get_distr(gen)) );
+  }
+
+  /* the generator must not call R functions during sampling */
+  if (! _Runuran_is_threadsafe(gen)) {
+    Rf_error("[UNU.RAN - error] '%s': 'threads' not supported: method evaluates R functions",
+	     unur_distr_get_name(unur_get_distr(gen)) );
+  }
+
+  /* number of chunks */
+  n_chunks = 1 + (n-1) / RUNURAN_THREAD_CHUNK;
+
+#ifdef _OPENMP
+  if (threads > n_chunks) threads = n_chunks;
+#else
+  threads = 1;
+#endif
+
+  /* draw key for URNG streams from URNG of generator object */
+  /* (a native URNG does not use the R built-in URNG)         */
+  if (_Runuran_has_native_urng(gen)) {
+    urng0 = unur_get_urng(gen);
+    seed = (unsigned long) (4294967296. * unur_urng_sample(urng0));
+#if ULONG_MAX > 0xFFFFFFFFUL
+    seed |= ((unsigned long) (4294967296. * unur_urng_sample(urng0))) << 32;
+#endif
+  }
+  else {
+    GetRNGstate();
+    seed = (unsigned long) (4294967296. * unif_rand());
+#if ULONG_MAX > 0xFFFFFFFFUL
+    seed |= ((unsigned long) (4294967296. * unif_rand())) << 32;
+#endif
+    PutRNGstate();
+  }
+
+  /* allocate memory for result */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, n));
+  res = REAL(sexp_res);
+  if (is_discr)
+    K = (int*) R_alloc(threads * RUNURAN_SAMPLE_BLOCK, sizeof(int));
+  clone = (struct unur_gen **) R_alloc(threads, sizeof(struct unur_gen *));
+  urng = (UNUR_URNG **) R_alloc(threads, sizeof(UNUR_URNG *));
+
+  /* create clones of generator object with their own URNGs */
+  /* (adaptive methods share the hat of 'gen' instead)         */
+  is_shared = (gen->refine != NULL);
+  for (t=0; t<threads; t++) {
+    urng[t] = unur_urng_philox_new(seed, 0ul);
+    clone[t] = (is_shared) ? unur_gen_share(gen) : unur_gen_clone(gen);
+    if (clone[t] == NULL) {
+      for (j=0; j<t; j++) { unur_free(clone[j]); unur_urng_free(urng[j]); }
+      unur_urng_free(urng[t]);
+      Rf_error("[UNU.RAN - error] cannot clone UNU.RAN object");
+    }
+    unur_chg_urng(clone[t], urng[t]);
+  }
+
+  /* R API must not be called from within threads */
+  old_level = _Runuran_set_error_handler(0);
+
+  /* run generators */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(threads) schedule(static,1) private(t)
+#endif
+  for (j=0; j<n_chunks; j++) {
+    int i, k, nc, nb;
+    int *Kt;
+#ifdef _OPENMP
+    t = omp_get_thread_num();
+#else
+    t = 0;
+#endif
+    i = j * RUNURAN_THREAD_CHUNK;
+    nc = (n-i < RUNURAN_THREAD_CHUNK) ? n-i : RUNURAN_THREAD_CHUNK;
+    unur_urng_philox_set_stream(urng[t], (unsigned long) j);
+    if (! is_discr) {
+      unur_sample_cont_array(clone[t], res+i, nc);
+    }
+    else {
+      Kt = K + t * RUNURAN_SAMPLE_BLOCK;
+      for (; nc > 0; nc -= nb, i += nb) {
+	nb = (nc < RUNURAN_SAMPLE_BLOCK) ? nc : RUNURAN_SAMPLE_BLOCK;
+	unur_sample_discr_array(clone[t], Kt, nb);
+	for (k=0; k<nb; k++) res[i+k] = (double) Kt[k];
+      }
+    }
+  }
+
+  /* restore error handler */
+  _Runuran_set_error_handler(old_level);
+
+  /* refine hat of 'gen' using points collected by threads */
+  if (is_shared) {
+    for (t=0; t<threads; t++)
+      unur_gen_share_merge(clone[t]);
+  }
+
+  /* clear memory (the counters of the clones are added to those of 'gen') */
+  for (t=0; t<threads; t++) {
+    unur_gen_add_counters(gen, clone[t]);
+    unur_free(clone[t]);
+    unur_urng_free(urng[t]);
+  }
+
+  /* return result to R */
+  UNPROTECT(1);
+  return sexp_res;
+
+} /* end of _Runuran_sample_unur_threads() */
+
+/*---------------------------------------------------------------------------*/
+
+int
+_Runuran_is_threadsafe (const struct unur_gen *gen)
+     /*----------------------------------------------------------------------*/
+     /* Check whether sampling from generator object may run in a thread,    */
+     /* i.e., it does not evaluate R functions.                              */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   gen ... pointer to UNU.RAN generator object                        */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   TRUE if sampling is threadsafe, FALSE otherwise                    */
+     /*----------------------------------------------------------------------*/
+{
+  int i;
+
+  if (gen == NULL) return TRUE;
+
+  switch (gen->method) {
+  case UNUR_METH_PINV:
+  case UNUR_METH_HINV:
+  case UNUR_METH_DGT:
+  case UNUR_METH_DAU:
+  case UNUR_METH_HIST:
+  case UNUR_METH_EMPK:
+  case UNUR_METH_EMPL:
+    /* these methods only use tables computed during setup */
+    break;
+  default:
+    /* R functions are stored in the 'extobj' of the distribution */
+    if (gen->distr != NULL && gen->distr->extobj != NULL)
+      return FALSE;
+  }
+
+  /* check auxiliary generators */
+  if (! _Runuran_is_threadsafe(gen->gen_aux))
+    return FALSE;
+  for (i=0; i<gen->n_gen_aux_list; i++)
+    if (gen->gen_aux_list && ! _Runuran_is_threadsafe(gen->gen_aux_list[i]))
+      return FALSE;
+
+  return TRUE;
+
+} /* end of _Runuran_is_threadsafe() */
+
+/*---------------------------------------------------------------------------*/
@@ -26,20 +26,37 @@
 static const R_CallMethodDef CallEntries[] = {
     {"Runuran_CDF",            (DL_FUNC) &Runuran_CDF,            2},
     {"Runuran_PDF",            (DL_FUNC) &Runuran_PDF,            3},
+    {"Runuran_benchmark",      (DL_FUNC) &Runuran_benchmark,      4},
+    {"Runuran_cache_sample",   (DL_FUNC) &Runuran_cache_sample,   3},
+    {"Runuran_cache_size",     (DL_FUNC) &Runuran_cache_size,     1},
+    {"Runuran_cache_stats",    (DL_FUNC) &Runuran_cache_stats,    1},
     {"Runuran_cmv_init",       (DL_FUNC) &Runuran_cmv_init,       9},
-    {"Runuran_cont_init",      (DL_FUNC) &Runuran_cont_init,     11},
+    {"Runuran_cont_init",      (DL_FUNC) &Runuran_cont_init,     12},
+    {"Runuran_counters",       (DL_FUNC) &Runuran_counters,       3},
     {"Runuran_discr_init",     (DL_FUNC) &Runuran_discr_init,     9},
+    {"Runuran_fstr_eval",      (DL_FUNC) &Runuran_fstr_eval,      3},
     {"Runuran_init",           (DL_FUNC) &Runuran_init,           3},
-    {"Runuran_mixt",           (DL_FUNC) &Runuran_mixt,           4},
+    {"Runuran_mixt",           (DL_FUNC) &Runuran_mixt,           5},
     {"Runuran_pack",           (DL_FUNC) &Runuran_pack,           1},
     {"Runuran_performance",    (DL_FUNC) &Runuran_performance,    2},
     {"Runuran_print",          (DL_FUNC) &Runuran_print,          2},
     {"Runuran_quantile",       (DL_FUNC) &Runuran_quantile,       2},
-    {"Runuran_sample",         (DL_FUNC) &Runuran_sample,         2},
+    {"Runuran_sample",         (DL_FUNC) &Runuran_sample,         3},
+    {"Runuran_sample_params",  (DL_FUNC) &Runuran_sample_params,  2},
+    {"Runuran_sample_sorted",  (DL_FUNC) &Runuran_sample_sorted,  2},
     {"Runuran_set_aux_seed",   (DL_FUNC) &Runuran_set_aux_seed,   1},
+    {"Runuran_setup",          (DL_FUNC) &Runuran_setup,          1},
+    {"Runuran_set_profiling",  (DL_FUNC) &Runuran_set_profiling,  1},
+    {"Runuran_table_load",     (DL_FUNC) &Runuran_table_load,     2},
+    {"Runuran_table_save",     (DL_FUNC) &Runuran_table_save,     2},
+    {"Runuran_tdr_frozen",     (DL_FUNC) &Runuran_tdr_frozen,     3},
+    {"Runuran_std_cmv",        (DL_FUNC) &Runuran_std_cmv,        4},
     {"Runuran_std_cont",       (DL_FUNC) &Runuran_std_cont,       4},
     {"Runuran_std_discr",      (DL_FUNC) &Runuran_std_discr,      4},
     {"Runuran_use_aux_urng",   (DL_FUNC) &Runuran_use_aux_urng,   2},
+    {"Runuran_use_urng_buffer",(DL_FUNC) &Runuran_use_urng_buffer,2},
+    {"Runuran_use_native_urng",(DL_FUNC) &Runuran_use_native_urng,2},
+    {"Runuran_set_native_seed",(DL_FUNC) &Runuran_set_native_seed,2},
     {"Runuran_verify_hat",     (DL_FUNC) &Runuran_verify_hat,     2},
     {"Runuran_set_error_level",(DL_FUNC) &Runuran_set_error_level,1},
     {NULL, NULL, 0}
@@ -65,15 +82,12 @@ R_init_Runuran (DllInfo *info  ATTRIBUTE__UNUSED)
   /* Set R built-in generator as default URNG */
   unur_set_default_urng( unur_urng_new( _Runuran_R_unif_rand, NULL) );
 
-  /* We use a built-in generator from the UNU.RAN library for the auxiliary URNG */
+  /* We use a built-in generator from the UNU.RAN library for the auxiliary URNG. */
+  /* This generator stores its state in the URNG object.                       */
   {
     UNUR_URNG *aux;
-    /* create URNG object */
-    aux = unur_urng_new( unur_urng_MRG31k3p, NULL );
-    unur_urng_set_reset( aux, unur_urng_MRG31k3p_reset );
-    unur_urng_set_seed( aux, unur_urng_MRG31k3p_seed);
-    /* seed URNG object */
-    unur_urng_seed (aux, (long) time(NULL));
+    /* create and seed URNG object */
+    aux = unur_urng_MRG31k3p_new( (unsigned long) time(NULL) );
     /* set as auxiliary generator */
     unur_set_default_urng_aux( aux );
   }
@@ -150,6 +164,7 @@ R_unload_Runuran (DllInfo *info  ATTRIBUTE__UNUSED)
      /*   (void)                                                             */
      /*----------------------------------------------------------------------*/
 {
+  _Runuran_cache_free();
   unur_urng_free(unur_get_default_urng());
   unur_urng_free(unur_get_default_urng_aux());
 } /* end of R_unload_Runuran() */
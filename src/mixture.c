@@ -38,7 +38,8 @@
 /*****************************************************************************/
 
 SEXP
-Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion)
+Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion,
+	      SEXP sexp_grouped)
 /*---------------------------------------------------------------------------*/
 /* Create UNU.RAN generator object for mixture of distribution.              */
 /*                                                                           */
@@ -47,6 +48,8 @@ Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion
 /*   prob      ... probability vector                                        */ 
 /*   comp      ... vector of components: 'Runuran' objects (S4 classes)      */ 
 /*   inversion ... whether inversion method should be used (boolean)         */
+/*   grouped   ... whether samples are returned grouped by component         */
+/*                 (boolean)                                                 */
 /*                                                                           */
 /* Return:                                                                   */
 /*   pointer to UNU.RAN generator object                                     */
@@ -56,6 +59,7 @@ Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion
   double *prob;                /* probality vector */
   int n_comp;                  /* number of components */
   int useinversion;            /* whether inversion method should be used */
+  int grouped;                 /* whether samples are grouped by component */
   
   SEXP sexp_unur;              /* pointer to element in R list 'comp' */
   SEXP sexp_gen;               /* R pointer to generator object */
@@ -68,6 +72,7 @@ Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion
 
   /* extract boolean */
   useinversion = *LOGICAL(Rf_coerceVector(sexp_inversion, LGLSXP));
+  grouped = *LOGICAL(Rf_coerceVector(sexp_grouped, LGLSXP));
 
   /* extract length of component vector */
   n_comp = Rf_length(sexp_comp);
@@ -92,6 +97,10 @@ Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion
 	((comp[i]=R_ExternalPtrAddr(sexp_gen)) == NULL) ) {
       Rf_error("[UNU.RAN - error] invalid argument 'comp[%d]'. maybe packed?",i+1);
     }
+    if (unur_get_urng(comp[i]) != unur_get_default_urng()) {
+      /* components are cloned and share the URNG object with 'comp[i]' */
+      Rf_error("[UNU.RAN - error] invalid argument 'comp[%d]'. uses buffered or native URNG",i+1);
+    }
   }
 
   /* extract probability vector */
@@ -104,6 +113,9 @@ Runuran_mixt (SEXP sexp_obj, SEXP sexp_prob, SEXP sexp_comp, SEXP sexp_inversion
     if (useinversion) {
       unur_mixt_set_useinversion(par,TRUE);
     }
+    if (grouped == TRUE) {
+      unur_mixt_set_grouped(par,TRUE);
+    }
     gen = unur_init(par);
   }
   /* we do not need 'sexp_prob' any more */
@@ -591,3 +591,170 @@ Runuran_performance (SEXP sexp_unur, SEXP sexp_debug)
 } /* end of Runuran_performance() */
 
 /*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_counters (SEXP sexp_unur, SEXP sexp_count, SEXP sexp_reset)
+     /*----------------------------------------------------------------------*/
+     /* Switch counters of UNU.RAN generator object on or off, read and      */
+     /* reset them.                                                          */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur  ... 'Runuran' object (S4 class)                              */ 
+     /*   count ... TRUE: switch counters on, FALSE: switch counters off,    */
+     /*             NA: unchanged                                            */ 
+     /*   reset ... whether counters are set to 0 after reading              */ 
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   named numeric vector with counts (NULL if counters are off)        */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_gen;               /* R pointer to generator object */
+  struct unur_gen *gen = NULL; /* pointer to UNU.RAN object */
+  SEXP sexp_res;               /* vector with counts */
+  SEXP sexp_names;             /* names of counters */
+  int count, reset;
+  int i;
+
+  /* names of counters (in the order of unur_gen_get_counters()) */
+  const char *names[UNUR_GEN_N_COUNTERS] =
+    { "variates", "uniforms", "pdf.evals", "cdf.evals", "rejections", "refinements",
+      "search.steps" };
+
+  /* packed objects do not have a generator object */
+  if (! Rf_isNull(R_do_slot(sexp_unur, Rf_install("data"))))
+    return R_NilValue;
+
+  /* Extract pointer to UNU.RAN generator */
+  sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+  CHECK_UNUR_PTR(sexp_gen);
+  if (Rf_isNull(sexp_gen) || 
+      ((gen=R_ExternalPtrAddr(sexp_gen)) == NULL) )
+    return R_NilValue;
+
+  /* switch counters on or off */
+  count = *(LOGICAL( Rf_coerceVector(sexp_count, LGLSXP)));
+  if (count != NA_LOGICAL)
+    unur_gen_set_counters(gen, count);
+
+  /* read counters */
+  PROTECT(sexp_res = Rf_allocVector(REALSXP, UNUR_GEN_N_COUNTERS));
+  if (unur_gen_get_counters(gen, REAL(sexp_res)) != UNUR_SUCCESS) {
+    UNPROTECT(1);
+    return R_NilValue;
+  }
+  PROTECT(sexp_names = Rf_allocVector(STRSXP, UNUR_GEN_N_COUNTERS));
+  for (i=0; i<UNUR_GEN_N_COUNTERS; i++)
+    SET_STRING_ELT(sexp_names, i, Rf_mkChar(names[i]));
+  Rf_setAttrib(sexp_res, R_NamesSymbol, sexp_names);
+
+  /* reset counters */
+  reset = *(LOGICAL( Rf_coerceVector(sexp_reset, LGLSXP)));
+  if (reset == TRUE)
+    unur_gen_reset_counters(gen);
+
+  UNPROTECT(2);
+  return sexp_res;
+
+} /* end of Runuran_counters() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_setup (SEXP sexp_unur)
+     /*----------------------------------------------------------------------*/
+     /* Get wall time and number of PDF and CDF evaluations for each phase   */
+     /* of the setup of UNU.RAN generator object.                            */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   unur  ... 'Runuran' object (S4 class)                              */ 
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   R list with components 'phase', 'time', 'pdf.evals', 'cdf.evals'   */
+     /*   (NULL if profile is not available)                                 */
+     /*----------------------------------------------------------------------*/
+{
+  SEXP sexp_gen;               /* R pointer to generator object */
+  struct unur_gen *gen = NULL; /* pointer to UNU.RAN object */
+  SEXP sexp_res;               /* R list with profile */
+  SEXP sexp_names;             /* names of list components */
+  SEXP sexp_phase, sexp_time, sexp_pdf, sexp_cdf;
+  const char *phase;           /* name of setup phase */
+  double stats[3];             /* time, #PDF and #CDF of setup phase */
+  int n_phases;
+  int i;
+
+  /* names of list components */
+  const char *names[4] = { "phase", "time", "pdf.evals", "cdf.evals" };
+
+  /* packed objects do not have a generator object */
+  if (! Rf_isNull(R_do_slot(sexp_unur, Rf_install("data"))))
+    return R_NilValue;
+
+  /* Extract pointer to UNU.RAN generator */
+  sexp_gen = R_do_slot(sexp_unur, Rf_install("unur"));
+  CHECK_UNUR_PTR(sexp_gen);
+  if (Rf_isNull(sexp_gen) || 
+      ((gen=R_ExternalPtrAddr(sexp_gen)) == NULL) )
+    return R_NilValue;
+
+  /* number of recorded setup phases (including "total") */
+  n_phases = unur_gen_get_n_setup_phases(gen);
+  if (n_phases <= 0)
+    return R_NilValue;
+
+  /* read profile */
+  PROTECT(sexp_phase = Rf_allocVector(STRSXP, n_phases));
+  PROTECT(sexp_time = Rf_allocVector(REALSXP, n_phases));
+  PROTECT(sexp_pdf = Rf_allocVector(REALSXP, n_phases));
+  PROTECT(sexp_cdf = Rf_allocVector(REALSXP, n_phases));
+  for (i=0; i<n_phases; i++) {
+    phase = unur_gen_get_setup_phase(gen, i, stats);
+    SET_STRING_ELT(sexp_phase, i, Rf_mkChar(phase ? phase : ""));
+    REAL(sexp_time)[i] = stats[0];
+    REAL(sexp_pdf)[i] = stats[1];
+    REAL(sexp_cdf)[i] = stats[2];
+  }
+
+  /* create R list */
+  PROTECT(sexp_res = Rf_allocVector(VECSXP, 4));
+  SET_VECTOR_ELT(sexp_res, 0, sexp_phase);
+  SET_VECTOR_ELT(sexp_res, 1, sexp_time);
+  SET_VECTOR_ELT(sexp_res, 2, sexp_pdf);
+  SET_VECTOR_ELT(sexp_res, 3, sexp_cdf);
+  PROTECT(sexp_names = Rf_allocVector(STRSXP, 4));
+  for (i=0; i<4; i++)
+    SET_STRING_ELT(sexp_names, i, Rf_mkChar(names[i]));
+  Rf_setAttrib(sexp_res, R_NamesSymbol, sexp_names);
+
+  UNPROTECT(6);
+  return sexp_res;
+
+} /* end of Runuran_setup() */
+
+/*---------------------------------------------------------------------------*/
+
+SEXP
+Runuran_set_profiling (SEXP sexp_profile)
+     /*----------------------------------------------------------------------*/
+     /* Switch recording of setup profile of new generator objects on/off.   */
+     /*                                                                      */
+     /* Parameters:                                                          */
+     /*   profile ... TRUE: record setup profile, FALSE: do not record       */
+     /*                                                                      */
+     /* Return:                                                              */
+     /*   R_NilValue                                                         */
+     /*----------------------------------------------------------------------*/
+{
+  int profile;
+
+  profile = *(LOGICAL( Rf_coerceVector(sexp_profile, LGLSXP)));
+  if (profile == NA_LOGICAL)
+    Rf_error("[UNU.RAN - error] argument invalid: 'profile' must be TRUE or FALSE");
+
+  unur_set_default_profiling(profile);
+
+  return R_NilValue;
+
+} /* end of Runuran_set_profiling() */
+
+/*---------------------------------------------------------------------------*/
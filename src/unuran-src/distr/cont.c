@@ -17,6 +17,10 @@ static double _unur_distr_cont_eval_dlogpdf_tree( double x, const struct unur_di
 static double _unur_distr_cont_eval_cdf_tree( double x, const struct unur_distr *distr );
 static double _unur_distr_cont_eval_logcdf_tree( double x, const struct unur_distr *distr );
 static double _unur_distr_cont_eval_hr_tree( double x, const struct unur_distr *distr );
+static int _unur_distr_cont_eval_pdf_array_tree( const double *x, double *fx, int n,
+						 const struct unur_distr *distr );
+static int _unur_distr_cont_eval_logpdf_array_tree( const double *x, double *fx, int n,
+						    const struct unur_distr *distr );
 static void _unur_distr_cont_free( struct unur_distr *distr );
 static int _unur_distr_cont_find_mode( struct unur_distr *distr );
 static double _unur_aux_pdf(double x, void *p);
@@ -41,6 +45,8 @@ unur_distr_cont_new( void )
   DISTR.logcdf    = NULL;          
   DISTR.invcdf    = NULL;          
   DISTR.hr        = NULL;          
+  DISTR.pdf_array = NULL;          
+  DISTR.logpdf_array = NULL;       
   DISTR.init      = NULL;          
   DISTR.n_params  = 0;               
   for (i=0; i<UNUR_DISTR_MAXPARAMS; i++)
@@ -180,6 +186,59 @@ _unur_distr_cont_eval_pdf_from_logpdf( double x, const struct unur_distr *distr
   return exp(_unur_cont_logPDF(x,distr));
 } 
 int
+unur_distr_cont_set_pdf_array( struct unur_distr *distr, UNUR_FUNCT_CONT_ARRAY *pdf_array )
+{
+  _unur_check_NULL( NULL, distr, UNUR_ERR_NULL );
+  _unur_check_NULL( distr->name, pdf_array, UNUR_ERR_NULL );
+  _unur_check_distr_object( distr, CONT, UNUR_ERR_DISTR_INVALID );
+  if (DISTR.pdf == NULL) {
+    _unur_error(distr->name,UNUR_ERR_DISTR_REQUIRED,"PDF");
+    return UNUR_ERR_DISTR_REQUIRED;
+  }
+  if (DISTR.pdf_array != NULL) {
+    _unur_error(distr->name,UNUR_ERR_DISTR_SET,"Overwriting of PDF not allowed");
+    return UNUR_ERR_DISTR_SET;
+  }
+  if (distr->base) return UNUR_ERR_DISTR_INVALID;
+  DISTR.pdf_array = pdf_array;
+  return UNUR_SUCCESS;
+} 
+int
+unur_distr_cont_set_logpdf_array( struct unur_distr *distr, UNUR_FUNCT_CONT_ARRAY *logpdf_array )
+{
+  _unur_check_NULL( NULL, distr, UNUR_ERR_NULL );
+  _unur_check_NULL( distr->name, logpdf_array, UNUR_ERR_NULL );
+  _unur_check_distr_object( distr, CONT, UNUR_ERR_DISTR_INVALID );
+  if (DISTR.logpdf == NULL) {
+    _unur_error(distr->name,UNUR_ERR_DISTR_REQUIRED,"logPDF");
+    return UNUR_ERR_DISTR_REQUIRED;
+  }
+  if (DISTR.pdf_array != NULL || DISTR.logpdf_array != NULL) {
+    _unur_error(distr->name,UNUR_ERR_DISTR_SET,"Overwriting of logPDF not allowed");
+    return UNUR_ERR_DISTR_SET;
+  }
+  if (distr->base) return UNUR_ERR_DISTR_INVALID;
+  DISTR.logpdf_array = logpdf_array;
+  DISTR.pdf_array = _unur_distr_cont_eval_pdf_array_from_logpdf_array;
+  return UNUR_SUCCESS;
+} 
+int
+_unur_distr_cont_eval_pdf_array_from_logpdf_array( const double *x, double *fx, int n,
+						   const struct unur_distr *distr )
+{
+  int i, status;
+  if (DISTR.logpdf_array == NULL) {
+    _unur_error(distr->name,UNUR_ERR_DISTR_DATA,"");
+    return UNUR_ERR_DISTR_DATA;
+  }
+  status = (DISTR.logpdf_array)(x,fx,n,distr);
+  if (status != UNUR_SUCCESS)
+    return status;
+  for (i=0; i<n; i++)
+    fx[i] = exp(fx[i]);
+  return UNUR_SUCCESS;
+} 
+int
 unur_distr_cont_set_dlogpdf( struct unur_distr *distr, UNUR_FUNCT_CONT *dlogpdf )
 {
   _unur_check_NULL( NULL, distr, UNUR_ERR_NULL );
@@ -289,6 +348,8 @@ unur_distr_cont_set_pdfstr( struct unur_distr *distr, const char *pdfstr )
     DISTR.dpdf = NULL;
     DISTR.logpdf = NULL;
     DISTR.dlogpdf = NULL;
+    DISTR.pdf_array = NULL;
+    DISTR.logpdf_array = NULL;
   }
   if (DISTR.pdf != NULL) {
     _unur_error(distr->name,UNUR_ERR_DISTR_SET,"Overwriting of PDF not allowed");
@@ -301,6 +362,7 @@ unur_distr_cont_set_pdfstr( struct unur_distr *distr, const char *pdfstr )
     return UNUR_ERR_DISTR_SET;
   }
   DISTR.pdf  = _unur_distr_cont_eval_pdf_tree;
+  DISTR.pdf_array = _unur_distr_cont_eval_pdf_array_tree;
   if ( (DISTR.dpdftree = _unur_fstr_make_derivative(DISTR.pdftree)) == NULL )
     return UNUR_ERR_DISTR_DATA;
   DISTR.dpdf = _unur_distr_cont_eval_dpdf_tree;
@@ -321,6 +383,8 @@ unur_distr_cont_set_logpdfstr( struct unur_distr *distr, const char *logpdfstr )
     DISTR.dpdf = NULL;
     DISTR.logpdf = NULL;
     DISTR.dlogpdf = NULL;
+    DISTR.pdf_array = NULL;
+    DISTR.logpdf_array = NULL;
   }
   if (DISTR.pdf != NULL || DISTR.logpdf != NULL) {
     _unur_error(distr->name,UNUR_ERR_DISTR_SET,"Overwriting of logPDF not allowed");
@@ -334,6 +398,8 @@ unur_distr_cont_set_logpdfstr( struct unur_distr *distr, const char *logpdfstr )
   }
   DISTR.logpdf  = _unur_distr_cont_eval_logpdf_tree;
   DISTR.pdf = _unur_distr_cont_eval_pdf_from_logpdf;
+  DISTR.logpdf_array = _unur_distr_cont_eval_logpdf_array_tree;
+  DISTR.pdf_array = _unur_distr_cont_eval_pdf_array_from_logpdf_array;
   if ( (DISTR.dlogpdftree = _unur_fstr_make_derivative(DISTR.logpdftree)) == NULL )
     return UNUR_ERR_DISTR_DATA;
   DISTR.dlogpdf = _unur_distr_cont_eval_dlogpdf_tree;
@@ -358,8 +424,10 @@ unur_distr_cont_set_cdfstr( struct unur_distr *distr, const char *cdfstr )
   }
   DISTR.cdf  = _unur_distr_cont_eval_cdf_tree;
   if (DISTR.pdftree == NULL)
-    if ( (DISTR.pdftree = _unur_fstr_make_derivative(DISTR.cdftree)) != NULL )
+    if ( (DISTR.pdftree = _unur_fstr_make_derivative(DISTR.cdftree)) != NULL ) {
       DISTR.pdf = _unur_distr_cont_eval_pdf_tree;
+      DISTR.pdf_array = _unur_distr_cont_eval_pdf_array_tree;
+    }
   if (DISTR.dpdftree == NULL)
     if ( (DISTR.dpdftree = _unur_fstr_make_derivative(DISTR.pdftree)) != NULL )
       DISTR.dpdf = _unur_distr_cont_eval_dpdf_tree;
@@ -414,6 +482,20 @@ _unur_distr_cont_eval_logpdf_tree( double x, const struct unur_distr *distr )
 {
   return ((DISTR.logpdftree) ? _unur_fstr_eval_tree(DISTR.logpdftree,x) : UNUR_INFINITY);
 } 
+int
+_unur_distr_cont_eval_pdf_array_tree( const double *x, double *fx, int n,
+				      const struct unur_distr *distr )
+{
+  if (DISTR.pdftree == NULL) return UNUR_ERR_DISTR_DATA;
+  return _unur_fstr_eval_tree_array(DISTR.pdftree,x,fx,n);
+} 
+int
+_unur_distr_cont_eval_logpdf_array_tree( const double *x, double *fx, int n,
+					 const struct unur_distr *distr )
+{
+  if (DISTR.logpdftree == NULL) return UNUR_ERR_DISTR_DATA;
+  return _unur_fstr_eval_tree_array(DISTR.logpdftree,x,fx,n);
+} 
 double
 _unur_distr_cont_eval_dpdf_tree( double x, const struct unur_distr *distr )
 {
@@ -562,6 +644,23 @@ unur_distr_cont_eval_pdf( double x, const struct unur_distr *distr )
   }
   return _unur_cont_PDF(x,distr);
 } 
+int
+unur_distr_cont_eval_pdf_array( const double *x, double *fx, int n, const struct unur_distr *distr )
+{
+  int i;
+  _unur_check_NULL( NULL, distr, UNUR_ERR_NULL );
+  _unur_check_distr_object( distr, CONT, UNUR_ERR_DISTR_INVALID );
+  if (DISTR.pdf == NULL) {
+    _unur_error(distr->name,UNUR_ERR_DISTR_DATA,"");
+    return UNUR_ERR_DISTR_DATA;
+  }
+  if (n <= 0) return UNUR_SUCCESS;
+  if (DISTR.pdf_array != NULL)
+    return _unur_cont_PDF_array(x,fx,n,distr);
+  for (i=0; i<n; i++)
+    fx[i] = _unur_cont_PDF(x[i],distr);
+  return UNUR_SUCCESS;
+} 
 double
 unur_distr_cont_eval_dpdf( double x, const struct unur_distr *distr )
 {
@@ -23,6 +23,9 @@ UNUR_FUNCT_CONT *unur_distr_cont_get_logcdf( const UNUR_DISTR *distribution );
 double unur_distr_cont_eval_logpdf( double x, const UNUR_DISTR *distribution );
 double unur_distr_cont_eval_dlogpdf( double x, const UNUR_DISTR *distribution );
 double unur_distr_cont_eval_logcdf( double x, const UNUR_DISTR *distribution );
+int unur_distr_cont_set_pdf_array( UNUR_DISTR *distribution, UNUR_FUNCT_CONT_ARRAY *pdf_array );
+int unur_distr_cont_set_logpdf_array( UNUR_DISTR *distribution, UNUR_FUNCT_CONT_ARRAY *logpdf_array );
+int unur_distr_cont_eval_pdf_array( const double *x, double *fx, int n, const UNUR_DISTR *distribution );
 int unur_distr_cont_set_pdfstr( UNUR_DISTR *distribution, const char *pdfstr );
 int unur_distr_cont_set_cdfstr( UNUR_DISTR *distribution, const char *cdfstr );
 char *unur_distr_cont_get_pdfstr( const UNUR_DISTR *distribution );
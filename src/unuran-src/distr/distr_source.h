@@ -34,6 +34,7 @@
 #define _unur_cont_logCDF(x,distr)  ((*((distr)->data.cont.logcdf)) ((x),(distr)))
 #define _unur_cont_invCDF(u,distr)  ((*((distr)->data.cont.invcdf)) ((u),(distr)))
 #define _unur_cont_HR(x,distr)      ((*((distr)->data.cont.hr))  ((x),(distr)))
+#define _unur_cont_PDF_array(x,fx,n,distr) ((*((distr)->data.cont.pdf_array)) ((x),(fx),(n),(distr)))
 #define _unur_discr_PMF(x,distr)    ((*((distr)->data.discr.pmf))((x),(distr)))
 #define _unur_discr_CDF(x,distr)    ((*((distr)->data.discr.cdf))((x),(distr)))
 #define _unur_discr_invCDF(u,distr) ((int) (*((distr)->data.discr.invcdf)) ((u),(distr)))
@@ -45,7 +46,9 @@ int _unur_cvec_dlogPDF(double *result, const double *x, struct unur_distr *distr
 double _unur_cvec_pdlogPDF(const double *x, int coord, struct unur_distr *distr);
 #define _unur_cont_have_logPDF(distr)  (((distr)->data.cont.logpdf==NULL)?FALSE:TRUE)
 #define _unur_cont_have_dlogPDF(distr) (((distr)->data.cont.dlogpdf==NULL)?FALSE:TRUE)
+#define _unur_cont_have_PDF_array(distr) (((distr)->data.cont.pdf_array==NULL)?FALSE:TRUE)
 double _unur_distr_cont_eval_pdf_from_logpdf( double x, const struct unur_distr *distr );
+int _unur_distr_cont_eval_pdf_array_from_logpdf_array( const double *x, double *fx, int n, const struct unur_distr *distr );
 double _unur_distr_cont_eval_dpdf_from_dlogpdf( double x, const struct unur_distr *distr );
 double _unur_distr_cont_eval_cdf_from_logcdf( double x, const struct unur_distr *distr );
 double _unur_distr_cvec_eval_pdf_from_logpdf( const double *x, struct unur_distr *distr );
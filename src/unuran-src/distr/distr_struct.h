@@ -10,6 +10,8 @@ struct unur_distr_cont {
   UNUR_FUNCT_CONT *dlogpdf;     
   UNUR_FUNCT_CONT *logcdf;      
   UNUR_FUNCT_CONT *hr;          
+  UNUR_FUNCT_CONT_ARRAY *pdf_array;    
+  UNUR_FUNCT_CONT_ARRAY *logpdf_array; 
   double norm_constant;         
   double params[UNUR_DISTR_MAXPARAMS];  
   int    n_params;              
@@ -5,6 +5,7 @@
 #include <methods/cstd.h>
 #include <methods/cstd_struct.h>
 #include "unur_distributions_source.h"
+static double exponential_zigg_slow( struct unur_gen *gen, double u, int i );
 #define PAR       ((struct unur_cstd_par*)par->datap) 
 #define GEN       ((struct unur_cstd_gen*)gen->datap) 
 #define DISTR     gen->distr->data.cont 
@@ -20,6 +21,10 @@ _unur_stdgen_exponential_init( struct unur_par *par, struct unur_gen *gen )
     if (gen) GEN->is_inversion = TRUE;
     _unur_cstd_set_sampling_routine(gen, _unur_stdgen_sample_exponential_inv);
     return UNUR_SUCCESS;
+  case 1:  
+    _unur_cstd_set_sampling_routine(gen, _unur_stdgen_sample_exponential_zigg);
+    gen->sample_array.cont = _unur_stdgen_sample_exponential_zigg_array;
+    return UNUR_SUCCESS;
   default: 
     if (gen) _unur_warning(gen->genid,UNUR_ERR_SHOULD_NOT_HAPPEN,"");
     return UNUR_FAILURE;
@@ -34,5 +39,184 @@ double _unur_stdgen_sample_exponential_inv( struct unur_gen *gen )
   X = - log( 1. - U );
   return ((DISTR.n_params==0) ? X : theta + sigma * X);
 } 
+static const double exponential_zigg_x[257] = {
+  8.6971174701310847, 7.6971174701310501, 6.9410336293772108, 6.478378493832567,
+  6.14416466577247, 5.8821443157953963, 5.6664101674540301, 5.4828906275260589,
+  5.3230905057543945, 5.1814872813014965, 5.0542884899813005, 4.938777085901247,
+  4.8329397410251076, 4.7352429966017366, 4.6444918854200807, 4.5597370617073469,
+  4.4802117465284175, 4.4052876934735679, 4.3344436803172677, 4.2672424802773614,
+  4.2033137137351799, 4.142340865664047, 4.0840513104082934, 4.0282085446479323,
+  3.9746060666737844, 3.9230625001354853, 3.8734176703995047, 3.8255294185223323,
+  3.7792709924116634, 3.7345288940397929, 3.6912010902374144, 3.6491955157608493,
+  3.6084288131289051, 3.568825265648333, 3.5303158891293394, 3.4928376547740556,
+  3.4563328211327562, 3.4207483572511159, 3.386035442460297, 3.3521490309001054,
+  3.319047470970744, 3.2866921715990647, 3.2550473085704459, 3.2240795652862602,
+  3.1937579032122363, 3.1640533580259689, 3.134938858084436, 3.10638906233982,
+  3.0783802152540858, 3.0508900166154507, 3.0238975044556722, 2.9973829495161262,
+  2.9713277599210852, 2.9457143948950413, 2.9205262865127364, 2.8957477686001374,
+  2.8713640120155319, 2.8473609656351844, 2.8237253024500308, 2.8004443702507333,
+  2.7775061464397521, 2.7548991965623402, 2.7326126361946956, 2.7106360958679243,
+  2.6889596887417988, 2.6675739807732617, 2.6464699631518038, 2.6256390267977832,
+  2.6050729387408302, 2.5847638202141354, 2.5647041263168999, 2.5448866271118646,
+  2.5253043900378223, 2.5059507635285883, 2.4868193617402041, 2.4679040502973595,
+  2.4491989329782444, 2.4306983392644144, 2.4123968126888653, 2.3942890999214526,
+  2.3763701405361353, 2.358635057409332, 2.3410791477030291, 2.3236978743901906,
+  2.306486858283574, 2.2894418705322637, 2.272558825553149, 2.2558337743672134,
+  2.2392628983129033, 2.222842503111031, 2.2065690132576581, 2.1904389667232143,
+  2.1744490099377689, 2.1585958930438802, 2.1428764653998362, 2.1272876713173625,
+  2.1118265460190364, 2.0964902118017092, 2.0812758743932194, 2.0661808194905702,
+  2.0512024094685795, 2.0363380802487643, 2.0215853383189208, 2.0069417578945128,
+  1.9924049782135711, 1.9779727009573547, 1.9636426877895423, 1.9494127580071789,
+  1.9352807862970454, 1.9212447005915219, 1.9073024800183813, 1.8934521529393018,
+  1.879691795072205, 1.8660195276928215, 1.8524335159111693, 1.8389319670188735,
+  1.8255131289035134, 1.8121752885263842, 1.7989167704602844, 1.7857359354841194,
+  1.7726311792312988, 1.7596009308890681, 1.7466436519460677, 1.7337578349855649,
+  1.7209420025219289, 1.7081947058780513, 1.6955145241015315, 1.6829000629175475,
+  1.6703499537164457, 1.6578628525741663, 1.6454374393037172, 1.6330724165359849,
+  1.6207665088282515, 1.6085184617988519, 1.596327041286477, 1.5841910325326825,
+  1.5721092393862233, 1.5600804835278816, 1.5481036037145068, 1.5361774550410254,
+  1.5243009082192196, 1.5124728488721104, 1.5006921768428103, 1.4889578055167394,
+  1.4772686611561272, 1.4656236822457387, 1.454021818848787, 1.4424620319720061,
+  1.4309432929388732, 1.4194645827699766, 1.408024891569529, 1.3966232179170355,
+  1.3852585682631156, 1.3739299563284839, 1.3626364025050801, 1.3513769332583287,
+  1.3401505805294984, 1.3289563811371101, 1.3177933761763183, 1.3066606104151677,
+  1.2955571316865944, 1.284481990275006, 1.2734342382962345, 1.2624129290696087,
+  1.2514171164808459, 1.2404458543343997, 1.2294981956938424, 1.2185731922087835,
+  1.2076698934267542, 1.196787346088396, 1.1859245934041951, 1.1750806743109043,
+  1.1642546227056716, 1.1534454666557674, 1.1426522275816655, 1.1318739194110714,
+  1.1211095477013233, 1.1103581087274039, 1.0996185885325902, 1.0888899619385397,
+  1.0781711915113652, 1.0674612264799606, 1.0567590016025443, 1.0460634359770369,
+  1.0353734317905212, 1.0246878730026101, 1.0140056239570894, 1.0033255279156894,
+  0.99264640550726846, 0.98196705308505516, 0.97128624098389593, 0.96060271166865907,
+  0.94991517776406853, 0.93922231995525485, 0.92852278474720296, 0.91781518207003676,
+  0.90709808271568271, 0.89637001558988239, 0.88562946476174387, 0.87487486629101741,
+  0.86410460481099671, 0.85331700984236547, 0.8425103518103606, 0.8316828377342651,
+  0.82083260655440382, 0.80995772405741018, 0.79905617735547896, 0.78812586886948433,
+  0.77716460975912138, 0.76617011273542623, 0.75513998418197359, 0.74407171550049944,
+  0.73296267358435663, 0.72181009030874732, 0.71061105090964605, 0.69936248110322297,
+  0.68806113277373881, 0.67670356802951348, 0.66528614139266862, 0.65380497984765551,
+  0.64225596042452693, 0.63063468493348063, 0.61893645139486642, 0.60715622162029026,
+  0.59528858429149301, 0.58332771274875961, 0.57126731653257812, 0.55910058551153019,
+  0.54682012516329981, 0.53441788123715472, 0.52188505159212406, 0.50921198244364319,
+  0.49638804551865967, 0.48340149165345014, 0.47023927508215713, 0.45688684093140813,
+  0.44332786607354013, 0.42954394022539827, 0.4155141696003436, 0.40121467889626466,
+  0.38661797794110619, 0.37169214532990352, 0.35639976025837972, 0.34069648106483463,
+  0.32452911701689441, 0.30783295467491661, 0.29052795549121424, 0.27251318547844777,
+  0.25365836338589415, 0.23379048305965566, 0.21267151063094616, 0.18995868962240969,
+  0.1651276225641628, 0.13730498093998469, 0.10483850756578511, 0.063852163814956245,
+  0 };
+static const double exponential_zigg_r[256] = {
+  0.88501937527756969, 0.90177052075821229, 0.93334492234895627, 0.9484108826956823,
+  0.95735460160488206, 0.96332389401564789, 0.96761273284061822, 0.97085476756194788,
+  0.97339830605926736, 0.97545129720201762, 0.97714586250685487, 0.97857013122169989,
+  0.97978523431731246, 0.98083496216629562, 0.98175154014612565, 0.98255923223144104,
+  0.98327667144015996, 0.98391841394121538, 0.98449600340983379, 0.98501871716040235,
+  0.98549410007825688, 0.9859283537627439, 0.98632662483499056, 0.98669322171877949,
+  0.98703177983587331, 0.98734538903362712, 0.98763669297965662, 0.98790796748635723,
+  0.98816118281496423, 0.98839805366842159, 0.98862007962999832, 0.98882857811923941,
+  0.98902471143770976, 0.98920950910943584, 0.98938388644747399, 0.98954866007259046,
+  0.98970456095429549, 0.98985224542540917, 0.98999230452957998, 0.99012527198992906,
+  0.99025163103129221, 0.99037182024466175, 0.99048623864770002, 0.99059525006749283,
+  0.99069918694952086, 0.99079835367893498, 0.99089302948572944, 0.99098347099360529,
+  0.99106991446267267, 0.99115257776820054, 0.99123166215108904, 0.99130735377031254,
+  0.99137982508307188, 0.99144923607463231, 0.99151573535666204, 0.99157946115023921,
+  0.99164054216744923, 0.99169909840360515, 0.99175524185050945, 0.99180907713980859,
+  0.99186070212431754, 0.99191020840419331, 0.99195768180396959, 0.99200320280572929,
+  0.99204684694304812, 0.99208868515978688, 0.99212878413733741, 0.99216720659349922,
+  0.99220401155581028, 0.99223925461183005, 0.99227298813859877, 0.99230526151325416,
+  0.99233612130657078, 0.99236561146099878, 0.99239377345461544, 0.99242064645225525,
+  0.99244626744495057, 0.99247067137870859, 0.99249389127353815, 0.99251595833355921,
+  0.99253690204893663, 0.99255675029032009, 0.99257552939639304, 0.99259326425509031,
+  0.99260997837898157, 0.992625693975279, 0.99264043201087893, 0.99265421227281758,
+  0.99266705342448014, 0.99267897305787656, 0.99268998774226858, 0.99270011306940653,
+  0.99270936369561391, 0.99271775338093615, 0.99272529502555107, 0.992732000703623,
+  0.99273788169476451, 0.99274294851326073, 0.99274721093519136, 0.99275067802357986,
+  0.99275335815168719, 0.99275525902455197, 0.9927563876988813, 0.99275675060137658,
+  0.99275635354557445, 0.99275520174728571, 0.9927532998386881, 0.99275065188114386,
+  0.99274726137679481, 0.99274313127898395, 0.99273826400155152, 0.99273266142704697,
+  0.99272632491388924, 0.99271925530251537, 0.99271145292053586, 0.99270291758693296,
+  0.99269364861531262, 0.99268364481623561, 0.99267290449863754, 0.99266142547035219,
+  0.99264920503774434, 0.99263624000445749, 0.99262252666928041, 0.99260806082312947,
+  0.99259283774514351, 0.99257685219788694, 0.99256009842164661, 0.99254257012781588,
+  0.99252426049134423, 0.99250516214223861, 0.99248526715609153, 0.99246456704361197,
+  0.99244305273913003, 0.99242071458804337, 0.99239754233317123, 0.99237352509997245,
+  0.99234865138058859, 0.9923229090166612, 0.99229628518087165, 0.99226876635714678,
+  0.99224033831946779, 0.99221098610921499, 0.99218069401097431, 0.99214944552672835,
+  0.9921172233483414, 0.99208400932825103, 0.99204978444825997, 0.99201452878632412,
+  0.99197822148121484, 0.99194084069493027, 0.99190236357271777, 0.99186276620055802,
+  0.99182202355995108, 0.99178010947982875, 0.99173699658540471, 0.99169265624376002,
+  0.99164705850594381, 0.99160017204534567, 0.99155196409208457, 0.99150240036313231,
+  0.99145144498786364, 0.9913990604287054, 0.99134520739651888, 0.99128984476033,
+  0.99123292945097408, 0.99117441635819603, 0.99111425822069332, 0.99105240550855556,
+  0.99098880629748987, 0.99092340613417673, 0.99085614789203136, 0.99078697161658158,
+  0.99071581435959066, 0.99064261000097809, 0.99056728905748903, 0.9904897784769624,
+  0.99041000141693225, 0.99032787700616476, 0.9902433200875882, 0.99015624094091936,
+  0.99006654498309166, 0.98997413244440957, 0.98987889801810258, 0.98978073048071791,
+  0.98967951228048023, 0.98957511909044182, 0.98946741932286175, 0.98935627360084644,
+  0.98924153418280314, 0.98912304433473275, 0.98900063764476409, 0.98887413727364426,
+  0.98874335513410494, 0.98860809099110669, 0.98846813147392887, 0.98832324898986446,
+  0.98817320052790492, 0.98801772633919449, 0.98785654847919979, 0.98768936919438477,
+  0.98751586913370193, 0.98733570536229998, 0.98714850915145469, 0.98695388351475388,
+  0.98675140045588228, 0.98654059788784909, 0.9863209761769578, 0.98609199425710237,
+  0.98585306525074157, 0.98560355152190393, 0.98534275907338664, 0.98506993118442843,
+  0.98478424116596475, 0.98448478408730611, 0.98417056729975716, 0.98384049954802177,
+  0.98349337841764106, 0.98312787581408623, 0.98274252110380778, 0.98233568146602424,
+  0.98190553890171028, 0.98145006321710937, 0.98096698013499184, 0.98045373347714926,
+  0.97990744009148245, 0.97932483584681684, 0.97870221056072948, 0.97803532912240687,
+  0.97731933527054926, 0.97654863341021136, 0.97571674239409822, 0.97481611319623096,
+  0.97383789963829548, 0.97277166744713106, 0.97160502140444105, 0.97032312239453711,
+  0.96890805450552175, 0.96733798498544132, 0.96558603352123296, 0.96361872652487746,
+  0.96139384751146695, 0.95885738974131207, 0.95593914209661457, 0.95254613726150117,
+  0.94855265223826246, 0.94378444893277547, 0.93799298941023512, 0.93081134015790656,
+  0.9216746490790324, 0.90966709956572256, 0.89320233377214986, 0.86928175221883852,
+  0.83150825287654584, 0.76354482443436988, 0.60905258284881303, 0 };
+#define ZIGG_R      (7.69711747013104972)  
+#define ZIGG_N      (256)                  
+#define zigg_draw(u,i) \
+  do { (i) = ((int) (ZIGG_N * uniform())) & (ZIGG_N-1); \
+       (u) = uniform(); } while(0)
+double _unur_stdgen_sample_exponential_zigg( struct unur_gen *gen )
+{
+  double X,u;
+  int i;
+  CHECK_NULL(gen,UNUR_INFINITY);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_INFINITY);
+  zigg_draw(u,i);
+  X = (u < exponential_zigg_r[i]) ? u * exponential_zigg_x[i] : exponential_zigg_slow(gen,u,i);
+  return ((DISTR.n_params==0) ? X : theta + sigma * X);
+} 
+int _unur_stdgen_sample_exponential_zigg_array( struct unur_gen *gen, double *X, int n )
+{
+  double u;
+  int i,k;
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  COOKIE_CHECK(gen,CK_CSTD_GEN,UNUR_ERR_COOKIE);
+  for (k=0; k<n; k++) {
+    zigg_draw(u,i);
+    X[k] = (u < exponential_zigg_r[i]) ? u * exponential_zigg_x[i] : exponential_zigg_slow(gen,u,i);
+  }
+  if (DISTR.n_params > 0)
+    for (k=0; k<n; k++) X[k] = theta + sigma * X[k];
+  return UNUR_SUCCESS;
+} 
+double exponential_zigg_slow( struct unur_gen *gen, double u, int i )
+{
+  double x,f0,f1;
+  while (1) {
+    if (i==0)
+      return (ZIGG_R - log(uniform()));
+    x = u * exponential_zigg_x[i];
+    f0 = exp(x - exponential_zigg_x[i]);
+    f1 = exp(x - exponential_zigg_x[i+1]);
+    if (f1 + uniform() * (f0 - f1) < 1.)
+      return x;
+    zigg_draw(u,i);
+    if (u < exponential_zigg_r[i])
+      return (u * exponential_zigg_x[i]);
+  }
+} 
+#undef ZIGG_R
+#undef ZIGG_N
+#undef zigg_draw
 #undef sigma
 #undef theta
@@ -4,6 +4,7 @@
 #include <unur_source.h>
 #include <methods/cstd.h>
 #include <methods/cstd_struct.h>
+#include <methods/x_gen.h>
 #include <methods/x_gen_source.h>
 #include <distr/distr_source.h>
 #include "unur_distributions_source.h"
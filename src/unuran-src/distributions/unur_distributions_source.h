@@ -16,6 +16,8 @@ int _unur_stdgen_chi_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 double _unur_stdgen_sample_chi_chru( UNUR_GEN *generator );
 int _unur_stdgen_exponential_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 double _unur_stdgen_sample_exponential_inv( UNUR_GEN *generator );
+double _unur_stdgen_sample_exponential_zigg( UNUR_GEN *generator );
+int _unur_stdgen_sample_exponential_zigg_array( UNUR_GEN *generator, double *X, int n );
 int _unur_stdgen_extremeI_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_extremeII_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_gamma_init( UNUR_PAR *parameters, UNUR_GEN *generator );
@@ -36,6 +38,8 @@ double _unur_stdgen_sample_normal_leva( UNUR_GEN *generator );
 double _unur_stdgen_sample_normal_kr( UNUR_GEN *generator );
 double _unur_stdgen_sample_normal_acr( UNUR_GEN *generator );
 double _unur_stdgen_sample_normal_sum( UNUR_GEN *generator );
+double _unur_stdgen_sample_normal_zigg( UNUR_GEN *generator );
+int _unur_stdgen_sample_normal_zigg_array( UNUR_GEN *generator, double *X, int n );
 int _unur_stdgen_pareto_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_powerexponential_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 double _unur_stdgen_sample_powerexponential_epd( UNUR_GEN *generator );
@@ -49,6 +53,7 @@ int _unur_stdgen_uniform_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_weibull_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_multinormal_init( UNUR_GEN *generator );
 int _unur_stdgen_sample_multinormal_cholesky( UNUR_GEN *generator, double *X );
+int _unur_stdgen_sample_multinormal_cholesky_array( UNUR_GEN *generator, double *X, int n );
 int _unur_stdgen_binomial_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_geometric_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_sample_geometric_inv( UNUR_GEN *generator );
@@ -61,10 +66,13 @@ int _unur_stdgen_sample_poisson_pdac( UNUR_GEN *generator );
 int _unur_stdgen_sample_poisson_pprsc( UNUR_GEN *generator );
 int _unur_stdgen_zipf_init( UNUR_PAR *parameters, UNUR_GEN *generator );
 int _unur_stdgen_sample_zipf_zet( UNUR_GEN *generator );
+#define _unur_stdgen_normal_zigg_variant       (8u)
+#define _unur_stdgen_exponential_zigg_variant  (1u)
 #define _unur_cstd_set_sampling_routine(gen,routine) \
    do { \
      if ((gen)==NULL) return UNUR_SUCCESS;            \
      (gen)->sample.cont = (routine);                  \
+     (gen)->sample_array.cont = NULL;                 \
      ((struct unur_cstd_gen*)gen->datap)->sample_routine_name = #routine;   \
    } while (0)
 #define _unur_dstd_set_sampling_routine(gen,routine) \
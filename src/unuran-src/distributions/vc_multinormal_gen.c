@@ -21,10 +21,13 @@ _unur_stdgen_multinormal_init( struct unur_gen *gen )
     return UNUR_FAILURE;
   }
   gen->sample.cvec = _unur_stdgen_sample_multinormal_cholesky;
+  gen->sample_array.cvec = _unur_stdgen_sample_multinormal_cholesky_array;
   GEN->sample_routine_name = "_unur_stdgen_sample_multinormal_cholesky";
   return _unur_stdgen_init_multinormal_cholesky(gen);
 } 
 #define NORMAL  gen->gen_aux        
+#define MULTINORMAL_BLOCK_ROWS  (32)  
+#define MULTINORMAL_BLOCK_COLS  (64)  
 int
 _unur_stdgen_init_multinormal_cholesky( struct unur_gen *gen )
 {
@@ -32,7 +35,9 @@ _unur_stdgen_init_multinormal_cholesky( struct unur_gen *gen )
   COOKIE_CHECK(gen,CK_MVSTD_GEN,UNUR_ERR_COOKIE);
   if (NORMAL==NULL) {
     struct unur_distr *distr = unur_distr_normal(NULL,0);
-    NORMAL = unur_init( unur_cstd_new( distr ) );
+    struct unur_par *par = unur_cstd_new( distr );
+    unur_cstd_set_variant( par, _unur_stdgen_normal_zigg_variant );
+    NORMAL = unur_init( par );
     _unur_check_NULL( gen->genid, NORMAL, UNUR_ERR_NULL );
     NORMAL->urng = gen->urng;
     NORMAL->debug = gen->debug;
@@ -61,4 +66,63 @@ _unur_stdgen_sample_multinormal_cholesky( struct unur_gen *gen, double *X )
   return UNUR_SUCCESS;
 #undef idx
 } 
+int
+_unur_stdgen_sample_multinormal_cholesky_array( struct unur_gen *gen, double *X, int n )
+{
+#define idx(a,b) ((a)*dim+(b))
+#define NB  MULTINORMAL_BLOCK_ROWS
+  int i,i0,ni,j,k,jb,kb,je,ke;
+  int dim = gen->distr->dim;     
+  double *L = DISTR.cholesky;    
+  double *mean = DISTR.mean;     
+  double *W;                     
+  double acc[NB];               
+  double *wk, *wj, lkj;
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  COOKIE_CHECK(gen,CK_MVSTD_GEN,UNUR_ERR_COOKIE);
+  CHECK_NULL(X,UNUR_ERR_NULL);
+  W = _unur_xmalloc( NB * dim * sizeof(double) );
+  memset(W, 0, NB * dim * sizeof(double));
+  for (i0=0; i0<n; i0+=NB, X+=NB*dim) {
+    ni = _unur_min(NB, n-i0);
+    unur_sample_cont_array(NORMAL, X, ni*dim);
+    for (i=0; i<ni; i++)
+      for (k=0; k<dim; k++)
+	W[k*NB+i] = X[i*dim+k];
+    for (kb=((dim-1)/MULTINORMAL_BLOCK_COLS)*MULTINORMAL_BLOCK_COLS; kb>=0; kb-=MULTINORMAL_BLOCK_COLS) {
+      ke = _unur_min(kb+MULTINORMAL_BLOCK_COLS, dim);
+      for (k=ke-1; k>=kb; k--) {
+	wk = W+k*NB;
+	lkj = L[idx(k,k)];
+	for (i=0; i<NB; i++) acc[i] = wk[i] * lkj;
+	for (j=k-1; j>=kb; j--) {
+	  wj = W+j*NB;  lkj = L[idx(k,j)];
+	  for (i=0; i<NB; i++) acc[i] += wj[i] * lkj;
+	}
+	for (i=0; i<NB; i++) wk[i] = acc[i];
+      }
+      for (jb=kb-MULTINORMAL_BLOCK_COLS; jb>=0; jb-=MULTINORMAL_BLOCK_COLS) {
+	je = jb+MULTINORMAL_BLOCK_COLS;
+	for (k=ke-1; k>=kb; k--) {
+	  wk = W+k*NB;
+	  for (i=0; i<NB; i++) acc[i] = wk[i];
+	  for (j=je-1; j>=jb; j--) {
+	    wj = W+j*NB;  lkj = L[idx(k,j)];
+	    for (i=0; i<NB; i++) acc[i] += wj[i] * lkj;
+	  }
+	  for (i=0; i<NB; i++) wk[i] = acc[i];
+	}
+      }
+    }
+    for (i=0; i<ni; i++)
+      for (k=0; k<dim; k++)
+	X[i*dim+k] = W[k*NB+i] + mean[k];
+  }
+  free(W);
+  return UNUR_SUCCESS;
+#undef NB
+#undef idx
+} 
+#undef MULTINORMAL_BLOCK_ROWS
+#undef MULTINORMAL_BLOCK_COLS
 #undef NORMAL
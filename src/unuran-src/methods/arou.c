@@ -32,6 +32,7 @@ static struct unur_gen *_unur_arou_clone( const struct unur_gen *gen );
 static void _unur_arou_free( struct unur_gen *gen);
 static double _unur_arou_sample( struct unur_gen *gen );
 static double _unur_arou_sample_check( struct unur_gen *gen );
+static int _unur_arou_sample_array( struct unur_gen *gen, double *X, int n );
 static int _unur_arou_get_starting_cpoints( struct unur_par *par, struct unur_gen *gen );
 static int _unur_arou_get_starting_segments( struct unur_gen *gen );
 static double _unur_arou_compute_x( double v, double u );
@@ -40,6 +41,7 @@ static struct unur_arou_segment *_unur_arou_segment_new( struct unur_gen *gen, d
 static int _unur_arou_segment_parameter( struct unur_gen *gen, struct unur_arou_segment *seg );
 static int _unur_arou_segment_split( struct unur_gen *gen, struct unur_arou_segment *seg_old, double x, double fx );
 static int _unur_arou_make_guide_table( struct unur_gen *gen );
+static int _unur_arou_refine( struct unur_gen *gen, double x, double fx );
 static double _unur_arou_segment_arcmean( struct unur_arou_segment *seg );
 #ifdef UNUR_ENABLE_LOGGING
 static void _unur_arou_debug_init( const struct unur_par *par, const struct unur_gen *gen );
@@ -64,11 +66,15 @@ static void _unur_arou_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define PDF(x)    _unur_cont_PDF((x),(gen->distr))  
+#define SAMPLE_ARRAY  gen->sample_array.cont
+#define PDF(x)    (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
 #define dPDF(x)   _unur_cont_dPDF((x),(gen->distr)) 
 #define _unur_arou_getSAMPLE(gen) \
    ( ((gen)->variant & AROU_VARFLAG_VERIFY) \
      ? _unur_arou_sample_check : _unur_arou_sample )
+#define _unur_arou_getSAMPLE_ARRAY(gen) \
+   ( ((gen)->variant & AROU_VARFLAG_VERIFY) \
+     ? NULL : _unur_arou_sample_array )
 struct unur_par *
 unur_arou_new( const struct unur_distr *distr )
 { 
@@ -233,6 +239,7 @@ unur_arou_chg_verify( struct unur_gen *gen, int verify )
   else
     gen->variant &= ~AROU_VARFLAG_VERIFY;
   SAMPLE = _unur_arou_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_arou_getSAMPLE_ARRAY(gen);
   return UNUR_SUCCESS;
 } 
 int
@@ -327,8 +334,10 @@ _unur_arou_create( struct unur_par *par )
   COOKIE_SET(gen,CK_AROU_GEN);
   gen->genid = _unur_set_genid(GENTYPE);
   SAMPLE = _unur_arou_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_arou_getSAMPLE_ARRAY(gen);
   gen->destroy = _unur_arou_free;
   gen->clone = _unur_arou_clone;
+  gen->refine = _unur_arou_refine;
   GEN->seg         = NULL;
   GEN->n_segs      = 0;
   GEN->guide       = NULL;
@@ -369,7 +378,7 @@ _unur_arou_clone( const struct unur_gen *gen )
   clone_seg = NULL;
   clone_prev = NULL;
   for (seg = GEN->seg; seg != NULL; seg = next) {
-    clone_seg = _unur_xmalloc( sizeof(struct unur_arou_segment) );
+    clone_seg = _unur_gen_alloc( clone, sizeof(struct unur_arou_segment) );
     memcpy( clone_seg, seg, sizeof(struct unur_arou_segment) );
     if (clone_prev == NULL) {
       CLONE->seg = clone_seg;
@@ -401,13 +410,6 @@ _unur_arou_free( struct unur_gen *gen )
 #ifdef UNUR_ENABLE_LOGGING
   if (gen->debug) _unur_arou_debug_free(gen);
 #endif
-  {
-    struct unur_arou_segment *seg,*next;
-    for (seg = GEN->seg; seg != NULL; seg = next) {
-      next = seg->next;
-      free(seg);
-    }
-  }
   if (GEN->guide) free(GEN->guide);
   _unur_generic_free(gen);
 } 
@@ -426,6 +428,7 @@ _unur_arou_sample( struct unur_gen *gen )
     R *= GEN->Atotal;
     while (seg->Acum < R) {
       seg = seg->next;
+      _unur_gen_count(gen,n_search);
     }
     COOKIE_CHECK(seg,CK_AROU_SEG,UNUR_INFINITY);
     R = seg->Acum - R;
@@ -444,12 +447,16 @@ _unur_arou_sample( struct unur_gen *gen )
       x = (seg->ltp[0]*R1 + seg->rtp[0]*R2 + seg->mid[0]*R3) / u;
       fx = PDF(x);
       if (GEN->n_segs < GEN->max_segs) {
-	if (GEN->max_ratio * GEN->Atotal > GEN->Asqueeze) {
+	if (gen->deferred)
+	  _unur_gen_defer(gen,x,fx);
+	else if (GEN->max_ratio * GEN->Atotal > GEN->Asqueeze) {
 	  result_split = _unur_arou_segment_split(gen,seg,x,fx);
+	  if (result_split == UNUR_SUCCESS) _unur_gen_count(gen,n_refine);
 	  if ( !(result_split == UNUR_SUCCESS || result_split == UNUR_ERR_SILENT) ) {
 	    _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"");
 	    if (gen->variant & AROU_VARFLAG_PEDANTIC) {
 	      SAMPLE = _unur_sample_cont_error;
+	      SAMPLE_ARRAY = NULL;
 	      return UNUR_INFINITY;
 	    }
 	  }
@@ -462,9 +469,21 @@ _unur_arou_sample( struct unur_gen *gen )
       }
       if (u*u <= fx) 
 	return x;
+      _unur_gen_count(gen,n_reject);
     }
   }
 } 
+int
+_unur_arou_sample_array( struct unur_gen *gen, double *X, int n )
+{ 
+  int k;
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_AROU_GEN,UNUR_ERR_COOKIE);
+  for (k=0; k<n && SAMPLE == _unur_arou_sample; k++)
+    X[k] = _unur_arou_sample(gen);
+  for ( ; k<n; k++)
+    X[k] = SAMPLE(gen);
+  return UNUR_SUCCESS;
+} 
 double
 _unur_arou_sample_check( struct unur_gen *gen )
 { 
@@ -480,6 +499,7 @@ _unur_arou_sample_check( struct unur_gen *gen )
     R *= GEN->Atotal;
     while (seg->Acum < R) {
       seg = seg->next;
+      _unur_gen_count(gen,n_search);
     }
     COOKIE_CHECK(seg,CK_AROU_SEG,UNUR_INFINITY);
     R = seg->Acum - R;
@@ -510,12 +530,16 @@ _unur_arou_sample_check( struct unur_gen *gen )
       if (sqx*sqx > fx)
 	_unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"PDF not T-concave.");
       if (GEN->n_segs < GEN->max_segs) {
-	if (GEN->max_ratio * GEN->Atotal > GEN->Asqueeze) {
+	if (gen->deferred)
+	  _unur_gen_defer(gen,x,fx);
+	else if (GEN->max_ratio * GEN->Atotal > GEN->Asqueeze) {
 	  result_split = _unur_arou_segment_split(gen,seg,x,fx);
+	  if (result_split == UNUR_SUCCESS) _unur_gen_count(gen,n_refine);
 	  if ( !(result_split == UNUR_SUCCESS || result_split == UNUR_ERR_SILENT) ) {
 	    _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"");
 	    if (gen->variant & AROU_VARFLAG_PEDANTIC) {
 	      SAMPLE = _unur_sample_cont_error;
+	      SAMPLE_ARRAY = NULL;
 	      return UNUR_INFINITY;
 	    }
 	  }
@@ -528,10 +552,43 @@ _unur_arou_sample_check( struct unur_gen *gen )
       }
       if (u*u <= fx) 
 	return x;
+      _unur_gen_count(gen,n_reject);
     }
   }
 } 
 int
+_unur_arou_refine( struct unur_gen *gen, double x, double fx )
+{
+  struct unur_arou_segment *seg;
+  int result_split;
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_AROU_GEN,UNUR_ERR_COOKIE);
+  if (GEN->n_segs >= GEN->max_segs)
+    return UNUR_SUCCESS;
+  if (! (GEN->max_ratio * GEN->Atotal > GEN->Asqueeze) ) {
+    GEN->max_segs = GEN->n_segs;
+    return UNUR_SUCCESS;
+  }
+  for (seg = GEN->seg; seg != NULL; seg = seg->next)
+    if (seg->ltp[0] <= x * seg->ltp[1] && seg->rtp[0] >= x * seg->rtp[1])
+      break;
+  if (seg == NULL)
+    return UNUR_SUCCESS;
+  result_split = _unur_arou_segment_split(gen,seg,x,fx);
+  if (result_split == UNUR_SUCCESS) _unur_gen_count(gen,n_refine);
+  if ( !(result_split == UNUR_SUCCESS || result_split == UNUR_ERR_SILENT) ) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"");
+    if (gen->variant & AROU_VARFLAG_PEDANTIC) {
+      SAMPLE = _unur_sample_cont_error;
+      SAMPLE_ARRAY = NULL;
+      return UNUR_ERR_GEN_CONDITION;
+    }
+  }
+  else {
+    _unur_arou_make_guide_table(gen);
+  }
+  return UNUR_SUCCESS;
+} 
+int
 _unur_arou_get_starting_cpoints( struct unur_par *par, struct unur_gen *gen )
 {
   struct unur_arou_segment *seg, *seg_new;
@@ -641,7 +698,7 @@ _unur_arou_get_starting_segments( struct unur_gen *gen )
 	seg->next = seg->next->next;
 	seg->rtp = seg->next->ltp;
 	seg->drtp = seg->next->dltp;
-	free(seg_tmp);
+	_unur_gen_release( gen, seg_tmp, sizeof(struct unur_arou_segment) );
 	--(GEN->n_segs);
       }
       else { 
@@ -693,7 +750,7 @@ _unur_arou_segment_new( struct unur_gen *gen, double x, double fx )
     _unur_error(gen->genid,UNUR_ERR_GEN_DATA,"PDF(x) overflow");
     return NULL;
   }
-  seg = _unur_xmalloc( sizeof(struct unur_arou_segment) );
+  seg = _unur_gen_alloc( gen, sizeof(struct unur_arou_segment) );
   seg->next = NULL; 
   ++(GEN->n_segs);   
   COOKIE_SET(seg,CK_AROU_SEG);
@@ -857,7 +914,7 @@ _unur_arou_segment_split( struct unur_gen *gen, struct unur_arou_segment *seg_ol
       memcpy(seg_oldl, &seg_bak, sizeof(struct unur_arou_segment));
       if (seg_newr) {
 	--(GEN->n_segs); 
-	free( seg_newr );
+	_unur_gen_release( gen, seg_newr, sizeof(struct unur_arou_segment) );
       }
       return UNUR_ERR_SILENT;
     }
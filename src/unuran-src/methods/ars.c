@@ -48,6 +48,7 @@ static int _unur_ars_interval_split( struct unur_gen *gen,
 				     struct unur_ars_interval *iv_old, double x, double logfx );
 static int _unur_ars_improve_hat( struct unur_gen *gen, struct unur_ars_interval *iv,
 				  double x, double logfx);
+static int _unur_ars_refine( struct unur_gen *gen, double x, double logfx );
 static int _unur_ars_make_area_table( struct unur_gen *gen );
 #ifdef UNUR_ENABLE_LOGGING
 static void _unur_ars_debug_init_start( const struct unur_gen *gen );
@@ -74,7 +75,7 @@ static void _unur_ars_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define logPDF(x)  _unur_cont_logPDF((x),(gen->distr))   
+#define logPDF(x)  (_unur_gen_count(gen,n_pdf), _unur_cont_logPDF((x),(gen->distr)))
 #define dlogPDF(x) _unur_cont_dlogPDF((x),(gen->distr))  
 #define scaled_logarea(iv)  ((iv)->logAhat - GEN->logAmax)
 #define scaled_area(iv)     (exp(scaled_logarea(iv)))
@@ -421,6 +422,7 @@ _unur_ars_create( struct unur_par *par )
   gen->destroy = _unur_ars_free;
   gen->clone = _unur_ars_clone;
   gen->reinit = _unur_ars_reinit;
+  gen->refine = _unur_ars_refine;
   GEN->iv          = NULL;
   GEN->n_ivs       = 0;
   GEN->percentiles = NULL;
@@ -524,6 +526,7 @@ _unur_ars_sample( struct unur_gen *gen )
     U *= GEN->Atotal;
     while (iv->Acum < U) {
       iv = iv->next;
+      _unur_gen_count(gen,n_search);
     }
     U -= iv->Acum;    
     if (-U < (scaled_area(iv) * iv->Ahatr_fract)) { 
@@ -556,6 +559,7 @@ _unur_ars_sample( struct unur_gen *gen )
     logfx = logPDF(X);
     if (logV <= rescaled_logf(logfx))
       return X;
+    _unur_gen_count(gen,n_reject);
     if (GEN->n_ivs < GEN->max_ivs) {
       if (! (_unur_isfinite(X) && _unur_isfinite(logfx)) ) {
 	X = _unur_arcmean(iv->x,iv->next->x);  
@@ -589,6 +593,7 @@ _unur_ars_sample_check( struct unur_gen *gen )
     U *= GEN->Atotal;
     while (iv->Acum < U) {
       iv = iv->next;
+      _unur_gen_count(gen,n_search);
     }
     U -= iv->Acum;    
     if (-U < (scaled_area(iv) * iv->Ahatr_fract)) { 
@@ -630,6 +635,7 @@ _unur_ars_sample_check( struct unur_gen *gen )
       return X;
     if (logV <= rescaled_logf(logfx))
       return X;
+    _unur_gen_count(gen,n_reject);
     if (GEN->n_ivs < GEN->max_ivs) {
       if (! (_unur_isfinite(X) && _unur_isfinite(logfx)) ) {
 	X = _unur_arcmean(iv->x,iv->next->x);  
@@ -699,7 +705,10 @@ _unur_ars_improve_hat( struct unur_gen *gen, struct unur_ars_interval *iv,
 			  double x, double logfx )
 {
   int result;
+  if (gen->deferred)
+    return _unur_gen_defer(gen,x,logfx);
   result = _unur_ars_interval_split(gen, iv, x, logfx);
+  if (result == UNUR_SUCCESS) _unur_gen_count(gen,n_refine);
   if (result!=UNUR_SUCCESS && result!=UNUR_ERR_SILENT) {
     _unur_error(gen->genid,UNUR_ERR_GEN_CONDITION,"");
     if (gen->variant & ARS_VARFLAG_PEDANTIC) {
@@ -711,6 +720,18 @@ _unur_ars_improve_hat( struct unur_gen *gen, struct unur_ars_interval *iv,
   return UNUR_SUCCESS;
 } 
 int
+_unur_ars_refine( struct unur_gen *gen, double x, double logfx )
+{
+  struct unur_ars_interval *iv;
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_ARS_GEN,UNUR_ERR_COOKIE);
+  if (GEN->n_ivs >= GEN->max_ivs || GEN->iv == NULL)
+    return UNUR_SUCCESS;
+  for (iv = GEN->iv; iv->next != NULL && iv->next->x < x; iv = iv->next);
+  if (iv->next == NULL || x < iv->x)
+    return UNUR_SUCCESS;
+  return _unur_ars_improve_hat(gen, iv, x, logfx);
+} 
+int
 _unur_ars_starting_cpoints( struct unur_gen *gen )
 {
   struct unur_ars_interval *iv;
@@ -9,6 +9,7 @@
 #include <distributions/unur_distributions_source.h>
 #include <urng/urng.h>
 #include "unur_methods_source.h"
+#include "x_gen.h"
 #include "x_gen_source.h"
 #include "cstd.h"
 #include "cstd_struct.h"
@@ -135,6 +136,45 @@ unur_cstd_chg_truncated( struct unur_gen *gen, double left, double right )
 #endif
   return UNUR_SUCCESS;
 } 
+int
+unur_cstd_sample_params( struct unur_gen *gen, const double *params, int n_params, double *X, int n )
+{
+  double params_orig[UNUR_DISTR_MAXPARAMS];
+  int n_params_orig;
+  int *idx;
+  int i,j,k;
+  int rcode = UNUR_SUCCESS;
+  _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
+  _unur_check_gen_object( gen, CSTD, UNUR_ERR_GEN_INVALID );
+  _unur_check_NULL( gen->genid, params, UNUR_ERR_NULL );
+  _unur_check_NULL( gen->genid, X, UNUR_ERR_NULL );
+  if (n <= 0) return UNUR_SUCCESS;
+  if (n_params < 1 || n_params > UNUR_DISTR_MAXPARAMS) {
+    _unur_error(gen->genid,UNUR_ERR_DISTR_NPARAMS,"");
+    return UNUR_ERR_DISTR_NPARAMS;
+  }
+  idx = _unur_gen_sort_params( params, n_params, n );
+  if (idx == NULL) {
+    _unur_error(gen->genid,UNUR_ERR_DISTR_DOMAIN,"parameters not finite");
+    return UNUR_ERR_DISTR_DOMAIN;
+  }
+  n_params_orig = DISTR.n_params;
+  memcpy( params_orig, DISTR.params, n_params_orig * sizeof(double) );
+  for (i=0; i<n; i=j) {
+    for (j=i+1; j<n && _unur_gen_params_equal(params,n_params,idx[i],idx[j]); j++);
+    if ( unur_distr_cont_set_pdfparams( gen->distr, params+idx[i]*n_params, n_params ) != UNUR_SUCCESS
+	 || unur_reinit(gen) != UNUR_SUCCESS ) {
+      rcode = UNUR_ERR_GEN_DATA;
+      break;
+    }
+    for (k=i; k<j; k++)
+      X[idx[k]] = _unur_sample_cont(gen);
+  }
+  unur_distr_cont_set_pdfparams( gen->distr, params_orig, n_params_orig );
+  unur_reinit(gen);
+  free(idx);
+  return rcode;
+} 
 struct unur_gen *
 _unur_cstd_init( struct unur_par *par )
 { 
@@ -7,4 +7,5 @@
 UNUR_PAR *unur_cstd_new( const UNUR_DISTR *distribution );
 int unur_cstd_set_variant( UNUR_PAR *parameters, unsigned variant );
 int unur_cstd_chg_truncated( UNUR_GEN *generator, double left, double right );
+int unur_cstd_sample_params( UNUR_GEN *generator, const double *params, int n_params, double *X, int n );
 double unur_cstd_eval_invcdf( const UNUR_GEN *generator, double u );
@@ -40,7 +40,7 @@ static void _unur_dari_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.discr          
-#define PMF(x)    _unur_discr_PMF((x),(gen->distr))    
+#define PMF(x)    (_unur_gen_count(gen,n_pdf), _unur_discr_PMF((x),(gen->distr)))
 #define T(x) (-1./sqrt(x))    
 #define F(x) (-1./(x))        
 #define FM(x) (-1./(x))       
@@ -330,6 +330,7 @@ _unur_dari_sample( struct unur_gen *gen )
       if (sign[i]*U >= h)
 	return k;
     }
+    _unur_gen_count(gen,n_reject);
   }
 } 
 int
@@ -22,6 +22,7 @@ static int _unur_dau_check_par( struct unur_gen *gen );
 static struct unur_gen *_unur_dau_clone( const struct unur_gen *gen );
 static void _unur_dau_free( struct unur_gen *gen);
 static int _unur_dau_sample( struct unur_gen *gen );
+static int _unur_dau_sample_array( struct unur_gen *gen, int *K, int n );
 static int _unur_dau_create_tables( struct unur_gen *gen );
 static int _unur_dau_make_urntable( struct unur_gen *gen );
 #ifdef UNUR_ENABLE_LOGGING
@@ -36,7 +37,9 @@ static void _unur_dau_info( struct unur_gen *gen, int help );
 #define GEN       ((struct unur_dau_gen*)gen->datap) 
 #define DISTR     gen->distr->data.discr 
 #define SAMPLE    gen->sample.discr     
+#define SAMPLE_ARRAY  gen->sample_array.discr
 #define _unur_dau_getSAMPLE(gen)   (_unur_dau_sample)
+#define _unur_dau_getSAMPLE_ARRAY(gen)  (_unur_dau_sample_array)
 struct unur_par *
 unur_dau_new( const struct unur_distr *distr )
 { 
@@ -116,6 +119,7 @@ _unur_dau_reinit( struct unur_gen *gen )
     return rcode;
   }
   SAMPLE = _unur_dau_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_dau_getSAMPLE_ARRAY(gen);
 #ifdef UNUR_ENABLE_LOGGING
   if (gen->debug & DAU_DEBUG_REINIT) _unur_dau_debug_init(gen);
 #endif
@@ -130,6 +134,7 @@ _unur_dau_create( struct unur_par *par)
   COOKIE_SET(gen,CK_DAU_GEN);
   gen->genid = _unur_set_genid(GENTYPE);
   SAMPLE = _unur_dau_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_dau_getSAMPLE_ARRAY(gen);
   gen->destroy = _unur_dau_free;
   gen->clone = _unur_dau_clone;
   gen->reinit = _unur_dau_reinit;
@@ -161,10 +166,8 @@ _unur_dau_clone( const struct unur_gen *gen )
   struct unur_gen *clone;
   CHECK_NULL(gen,NULL);  COOKIE_CHECK(gen,CK_DAU_GEN,NULL);
   clone = _unur_generic_clone( gen, GENTYPE );
-  CLONE->jx = _unur_xmalloc( GEN->urn_size * sizeof(int) );
-  memcpy( CLONE->jx, GEN->jx, GEN->urn_size * sizeof(int) );
-  CLONE->qx = _unur_xmalloc( GEN->urn_size * sizeof(double) );
-  memcpy( CLONE->qx, GEN->qx, GEN->urn_size * sizeof(double) );
+  CLONE->jx = _unur_shared_ref( GEN->jx );
+  CLONE->qx = _unur_shared_ref( GEN->qx );
   return clone;
 #undef CLONE
 } 
@@ -178,8 +181,8 @@ _unur_dau_free( struct unur_gen *gen )
     return; }
   COOKIE_CHECK(gen,CK_DAU_GEN,RETURN_VOID);
   SAMPLE = NULL;   
-  if (GEN->jx) free(GEN->jx);
-  if (GEN->qx) free(GEN->qx);
+  _unur_shared_free(GEN->jx);
+  _unur_shared_free(GEN->qx);
   _unur_generic_free(gen);
 } 
 int
@@ -196,14 +199,42 @@ _unur_dau_sample( struct unur_gen *gen )
   return (((u <= GEN->qx[iu]) ? iu : GEN->jx[iu] ) + DISTR.domain[0]);
 } 
 int
+_unur_dau_sample_array( struct unur_gen *gen, int *K, int n )
+{ 
+  UNUR_URNG *urng;
+  double *qx;
+  int *jx;
+  double u;
+  int urn_size,len,dom0,iu,k;
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_DAU_GEN,UNUR_ERR_COOKIE);
+  urng = gen->urng;
+  qx = GEN->qx;
+  jx = GEN->jx;
+  urn_size = GEN->urn_size;
+  len = GEN->len;
+  dom0 = DISTR.domain[0];
+  for (k=0; k<n; k++) {
+    u = _unur_call_urng(urng);
+    u *= urn_size;
+    iu = (int) u;
+    if (iu >= len)
+      K[k] = jx[iu] + dom0;
+    else {
+      u -= iu;
+      K[k] = ((u <= qx[iu]) ? iu : jx[iu]) + dom0;
+    }
+  }
+  return UNUR_SUCCESS;
+} 
+int
 _unur_dau_create_tables( struct unur_gen *gen )
 { 
   GEN->len = DISTR.n_pv;
   GEN->urn_size = (int)(GEN->len * GEN->urn_factor);
   if (GEN->urn_size < GEN->len)
     GEN->urn_size = GEN->len;
-  GEN->jx = _unur_xrealloc( GEN->jx, GEN->urn_size * sizeof(int) );
-  GEN->qx = _unur_xrealloc( GEN->qx, GEN->urn_size * sizeof(double) );
+  GEN->jx = _unur_shared_realloc( GEN->jx, GEN->urn_size * sizeof(int) );
+  GEN->qx = _unur_shared_realloc( GEN->qx, GEN->urn_size * sizeof(double) );
   return UNUR_SUCCESS;
 } 
 int
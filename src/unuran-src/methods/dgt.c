@@ -26,6 +26,7 @@ static int _unur_dgt_check_par( struct unur_gen *gen );
 static struct unur_gen *_unur_dgt_clone( const struct unur_gen *gen );
 static void _unur_dgt_free( struct unur_gen *gen);
 static int _unur_dgt_sample( struct unur_gen *gen );
+static int _unur_dgt_sample_array( struct unur_gen *gen, int *K, int n );
 static int _unur_dgt_create_tables( struct unur_gen *gen );
 static int _unur_dgt_make_guidetable( struct unur_gen *gen );
 #ifdef UNUR_ENABLE_LOGGING
@@ -40,7 +41,9 @@ static void _unur_dgt_info( struct unur_gen *gen, int help );
 #define GEN       ((struct unur_dgt_gen*)gen->datap) 
 #define DISTR     gen->distr->data.discr 
 #define SAMPLE    gen->sample.discr     
+#define SAMPLE_ARRAY  gen->sample_array.discr
 #define _unur_dgt_getSAMPLE(gen)  (_unur_dgt_sample)
+#define _unur_dgt_getSAMPLE_ARRAY(gen)  (_unur_dgt_sample_array)
 struct unur_par *
 unur_dgt_new( const struct unur_distr *distr )
 { 
@@ -133,6 +136,7 @@ _unur_dgt_reinit( struct unur_gen *gen )
     return rcode;
   }
   SAMPLE = _unur_dgt_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_dgt_getSAMPLE_ARRAY(gen);
 #ifdef UNUR_ENABLE_LOGGING
   if (gen->debug & DGT_DEBUG_REINIT) _unur_dgt_debug_init(gen);
 #endif
@@ -147,6 +151,7 @@ _unur_dgt_create( struct unur_par *par )
   COOKIE_SET(gen,CK_DGT_GEN);
   gen->genid = _unur_set_genid(GENTYPE);
   SAMPLE = _unur_dgt_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_dgt_getSAMPLE_ARRAY(gen);
   gen->destroy = _unur_dgt_free;
   gen->clone = _unur_dgt_clone;
   gen->reinit = _unur_dgt_reinit;
@@ -179,10 +184,8 @@ _unur_dgt_clone( const struct unur_gen *gen )
   struct unur_gen *clone;
   CHECK_NULL(gen,NULL);  COOKIE_CHECK(gen,CK_DGT_GEN,NULL);
   clone = _unur_generic_clone( gen, GENTYPE );
-  CLONE->cumpv = _unur_xmalloc( DISTR.n_pv * sizeof(double) );
-  memcpy( CLONE->cumpv, GEN->cumpv, DISTR.n_pv * sizeof(double) );
-  CLONE->guide_table = _unur_xmalloc( GEN->guide_size * sizeof(int) );
-  memcpy( CLONE->guide_table, GEN->guide_table, GEN->guide_size * sizeof(int) );
+  CLONE->cumpv = _unur_shared_ref( GEN->cumpv );
+  CLONE->guide_table = _unur_shared_ref( GEN->guide_table );
   return clone;
 #undef CLONE
 } 
@@ -196,23 +199,49 @@ _unur_dgt_free( struct unur_gen *gen )
     return; }
   COOKIE_CHECK(gen,CK_DGT_GEN,RETURN_VOID);
   SAMPLE = NULL;   
-  if (GEN->guide_table) free(GEN->guide_table);
-  if (GEN->cumpv)       free(GEN->cumpv);
+  _unur_shared_free(GEN->guide_table);
+  _unur_shared_free(GEN->cumpv);
   _unur_generic_free(gen);
 } 
 int
 _unur_dgt_sample( struct unur_gen *gen )
 { 
-  int j;
+  int j,j0;
   double u;
   CHECK_NULL(gen,INT_MAX);  COOKIE_CHECK(gen,CK_DGT_GEN,INT_MAX);
   u = _unur_call_urng(gen->urng);
-  j = GEN->guide_table[(int)(u * GEN->guide_size)];
+  j = j0 = GEN->guide_table[(int)(u * GEN->guide_size)];
   u *= GEN->sum;
   while (GEN->cumpv[j] < u) j++;
+  _unur_gen_count_n(gen,n_search,j-j0);
   return (j + DISTR.domain[0]);
 } 
 int
+_unur_dgt_sample_array( struct unur_gen *gen, int *K, int n )
+{ 
+  UNUR_URNG *urng;
+  double *cumpv;
+  int *guide;
+  double u,sum;
+  int guide_size,dom0,j,j0,k;
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_DGT_GEN,UNUR_ERR_COOKIE);
+  urng = gen->urng;
+  cumpv = GEN->cumpv;
+  guide = GEN->guide_table;
+  guide_size = GEN->guide_size;
+  sum = GEN->sum;
+  dom0 = DISTR.domain[0];
+  for (k=0; k<n; k++) {
+    u = _unur_call_urng(urng);
+    j = j0 = guide[(int)(u * guide_size)];
+    u *= sum;
+    while (cumpv[j] < u) j++;
+    _unur_gen_count_n(gen,n_search,j-j0);
+    K[k] = j + dom0;
+  }
+  return UNUR_SUCCESS;
+} 
+int
 unur_dgt_eval_invcdf_recycle( const struct unur_gen *gen, double u, double *recycle )
 {
   int j;
@@ -248,13 +277,41 @@ unur_dgt_eval_invcdf( const struct unur_gen *gen, double u )
   return unur_dgt_eval_invcdf_recycle(gen,u,NULL);
 } 
 int
+unur_dgt_eval_invcdf_sorted( const struct unur_gen *gen, const double *U, double *X, int n )
+{
+  const double *cumpv;
+  double u,sum;
+  int j,k,K;
+  _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
+  if ( gen->method != UNUR_METH_DGT ) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"");
+    return UNUR_ERR_GEN_INVALID;
+  }
+  COOKIE_CHECK(gen,CK_DGT_GEN,UNUR_ERR_COOKIE);
+  cumpv = GEN->cumpv;
+  sum = GEN->sum;
+  for (k=0, j=0; k<n; k++) {
+    if (! (U[k]>0. && U[k]<1.)) {
+      X[k] = (double) unur_dgt_eval_invcdf(gen,U[k]);
+      continue;
+    }
+    u = U[k] * sum;
+    while (cumpv[j] < u) j++;
+    K = j + DISTR.domain[0];
+    if (K<DISTR.domain[0]) K = DISTR.domain[0];
+    if (K>DISTR.domain[1]) K = DISTR.domain[1];
+    X[k] = (double) K;
+  }
+  return UNUR_SUCCESS;
+} 
+int
 _unur_dgt_create_tables( struct unur_gen *gen )
 { 
   GEN->guide_size = (int)( DISTR.n_pv * GEN->guide_factor);
   if (GEN->guide_size <= 0)
     GEN->guide_size = 1;
-  GEN->cumpv = _unur_xrealloc( GEN->cumpv, DISTR.n_pv * sizeof(double) );
-  GEN->guide_table = _unur_xrealloc( GEN->guide_table, GEN->guide_size * sizeof(int) );
+  GEN->cumpv = _unur_shared_realloc( GEN->cumpv, DISTR.n_pv * sizeof(double) );
+  GEN->guide_table = _unur_shared_realloc( GEN->guide_table, GEN->guide_size * sizeof(int) );
   return UNUR_SUCCESS;
 } 
 int
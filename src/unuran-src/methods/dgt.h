@@ -6,3 +6,4 @@ int unur_dgt_set_guidefactor( UNUR_PAR *parameters, double factor );
 int unur_dgt_set_variant( UNUR_PAR *parameters, unsigned variant );
 int unur_dgt_eval_invcdf_recycle( const UNUR_GEN *generator, double u, double *recycle );
 int unur_dgt_eval_invcdf( const UNUR_GEN *generator, double u );
+int unur_dgt_eval_invcdf_sorted( const UNUR_GEN *generator, const double *U, double *X, int n );
@@ -36,7 +36,7 @@ static void _unur_dsrou_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.discr          
-#define PMF(x)    _unur_discr_PMF((x),(gen->distr))   
+#define PMF(x)    (_unur_gen_count(gen,n_pdf), _unur_discr_PMF((x),(gen->distr)))
 #define _unur_dsrou_getSAMPLE(gen) \
    ( ((gen)->variant & DSROU_VARFLAG_VERIFY) \
      ? _unur_dsrou_sample_check : _unur_dsrou_sample )
@@ -226,11 +226,14 @@ _unur_dsrou_sample( struct unur_gen *gen )
     while ( _unur_iszero(U = _unur_call_urng(gen->urng)));
     U *= (V<0.) ? GEN->ul : GEN->ur;
     X = floor(V/U) + DISTR.mode;
-    if ( (X < DISTR.BD_LEFT) || (X > DISTR.BD_RIGHT) )
+    if ( (X < DISTR.BD_LEFT) || (X > DISTR.BD_RIGHT) ) {
+      _unur_gen_count(gen,n_reject);
       continue;
+    }
     I = (int) X;
     if (U*U <= PMF(I))
       return I;
+    _unur_gen_count(gen,n_reject);
   }
 } 
 int
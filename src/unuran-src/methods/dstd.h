@@ -4,4 +4,5 @@
 UNUR_PAR *unur_dstd_new( const UNUR_DISTR *distribution );
 int unur_dstd_set_variant( UNUR_PAR *parameters, unsigned variant );
 int unur_dstd_chg_truncated( UNUR_GEN *generator, int left, int right );
+int unur_dstd_sample_params( UNUR_GEN *generator, const double *params, int n_params, int *K, int n );
 int unur_dstd_eval_invcdf( const UNUR_GEN *generator, double u );
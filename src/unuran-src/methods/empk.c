@@ -6,6 +6,7 @@
 #include <distr/distr_source.h>
 #include <distributions/unur_distributions.h>
 #include <distributions/unur_stddistr.h>
+#include <distributions/unur_distributions_source.h>
 #include <urng/urng.h>
 #include "unur_methods_source.h"
 #include "x_gen.h"
@@ -86,6 +87,7 @@ int
 unur_empk_set_kernel( struct unur_par *par, unsigned kernel)
 {
   UNUR_DISTR *kerndist;
+  UNUR_PAR *kernpar;
   double fpar[4];
   _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
   _unur_check_par_object( par, EMPK );
@@ -107,7 +109,9 @@ unur_empk_set_kernel( struct unur_par *par, unsigned kernel)
     break;
   case UNUR_DISTR_GAUSSIAN:
     kerndist    = unur_distr_normal( NULL, 0 );
-    PAR->kernel  = unur_init( unur_cstd_new ( kerndist ) );
+    kernpar     = unur_cstd_new ( kerndist );
+    unur_cstd_set_variant( kernpar, _unur_stdgen_normal_zigg_variant );
+    PAR->kernel  = unur_init( kernpar );
     PAR->alpha   = 0.7763884;
     PAR->kernvar = 1.;
     unur_distr_free( kerndist );
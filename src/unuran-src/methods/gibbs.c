@@ -12,7 +12,8 @@
 #include "unur_methods_source.h"
 #include "x_gen.h"
 #include "x_gen_source.h"
-#include "arou.h"
+#include <distributions/unur_distributions_source.h>
+#include "cstd.h"
 #include "ars.h"
 #include "tdr.h"
 #include "gibbs.h"
@@ -489,8 +490,8 @@ _unur_gibbs_normalgen( struct unur_gen *gen )
 {
   struct unur_gen   *normalgen;
   struct unur_distr *normaldistr = unur_distr_normal(NULL,0);
-  struct unur_par   *normalpar = unur_arou_new( normaldistr );
-  unur_arou_set_usedars( normalpar, TRUE );
+  struct unur_par   *normalpar = unur_cstd_new( normaldistr );
+  unur_cstd_set_variant( normalpar, _unur_stdgen_normal_zigg_variant );
   normalgen = unur_init( normalpar );
   _unur_distr_free( normaldistr );
   if (normalgen == NULL) {
@@ -505,10 +506,8 @@ _unur_gibbs_normalgen( struct unur_gen *gen )
 void
 _unur_gibbs_random_unitvector( struct unur_gen *gen, double *direction )
 {
-  int i;
   do {
-    for (i=0; i<GEN->dim; i++) 
-      direction[i] = unur_sample_cont(GEN_NORMAL);
+    unur_sample_cont_array(GEN_NORMAL, direction, GEN->dim);
     _unur_vector_normalize(GEN->dim, direction);
   } while (!_unur_isfinite(direction[0]));
 } 
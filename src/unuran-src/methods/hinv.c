@@ -34,6 +34,7 @@ static int _unur_hinv_check_par( struct unur_gen *gen );
 static struct unur_gen *_unur_hinv_clone( const struct unur_gen *gen );
 static void _unur_hinv_free( struct unur_gen *gen );
 static double _unur_hinv_sample( struct unur_gen *gen );
+static int _unur_hinv_sample_array( struct unur_gen *gen, double *X, int n );
 static double _unur_hinv_eval_approxinvcdf( const struct unur_gen *gen, double u );
 static int _unur_hinv_find_boundary( struct unur_gen *gen );
 static int _unur_hinv_create_table( struct unur_gen *gen );
@@ -60,10 +61,12 @@ static void _unur_hinv_info( struct unur_gen *gen, int help );
 #define GEN       ((struct unur_hinv_gen*)gen->datap) 
 #define DISTR     gen->distr->data.cont 
 #define SAMPLE    gen->sample.cont      
-#define CDF(x)  (_unur_hinv_CDF((gen),(x)))
-#define PDF(x)  (_unur_cont_PDF((x),(gen->distr))/(GEN->CDFmax-GEN->CDFmin)) 
+#define SAMPLE_ARRAY  gen->sample_array.cont
+#define CDF(x)  (_unur_gen_count(gen,n_cdf), _unur_hinv_CDF((gen),(x)))
+#define PDF(x)  (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr))/(GEN->CDFmax-GEN->CDFmin)) 
 #define dPDF(x) (_unur_cont_dPDF((x),(gen->distr))/(GEN->CDFmax-GEN->CDFmin))
 #define _unur_hinv_getSAMPLE(gen)  (_unur_hinv_sample)
+#define _unur_hinv_getSAMPLE_ARRAY(gen)  (_unur_hinv_sample_array)
 struct unur_par *
 unur_hinv_new( const struct unur_distr *distr )
 { 
@@ -254,6 +257,7 @@ struct unur_gen *
 _unur_hinv_init( struct unur_par *par )
 { 
   struct unur_gen *gen;
+  int rcode;
   _unur_check_NULL( GENTYPE,par,NULL );
   if ( par->method != UNUR_METH_HINV ) {
     _unur_error(GENTYPE,UNUR_ERR_PAR_INVALID,"");
@@ -265,7 +269,10 @@ _unur_hinv_init( struct unur_par *par )
   if (_unur_hinv_check_par(gen) != UNUR_SUCCESS) {
     _unur_hinv_free(gen); return NULL;
   }
-  if (_unur_hinv_create_table(gen)!=UNUR_SUCCESS) {
+  _unur_gen_phase_begin(gen,"interval splitting");
+  rcode = _unur_hinv_create_table(gen);
+  _unur_gen_phase_end(gen);
+  if (rcode!=UNUR_SUCCESS) {
 #ifdef UNUR_ENABLE_LOGGING
     if (gen->debug) {
       _unur_hinv_list_to_array( gen );
@@ -277,7 +284,9 @@ _unur_hinv_init( struct unur_par *par )
   _unur_hinv_list_to_array( gen );
   GEN->Umin = _unur_max(0.,GEN->intervals[0]);
   GEN->Umax = _unur_min(1.,GEN->intervals[(GEN->N-1)*(GEN->order+2)]);
+  _unur_gen_phase_begin(gen,"guide table");
   _unur_hinv_make_guide_table(gen);
+  _unur_gen_phase_end(gen);
 #ifdef UNUR_ENABLE_LOGGING
   if (gen->debug) _unur_hinv_debug_init(gen,TRUE);
 #endif
@@ -297,6 +306,7 @@ _unur_hinv_reinit( struct unur_gen *gen )
   GEN->Umin = _unur_max(0.,GEN->intervals[0]);
   GEN->Umax = _unur_min(1.,GEN->intervals[(GEN->N-1)*(GEN->order+2)]);
   SAMPLE = _unur_hinv_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_hinv_getSAMPLE_ARRAY(gen);
 #ifdef UNUR_ENABLE_LOGGING
   if (gen->debug & HINV_DEBUG_REINIT) _unur_hinv_debug_init(gen,TRUE);
 #endif
@@ -312,6 +322,7 @@ _unur_hinv_create( struct unur_par *par )
   COOKIE_SET(gen,CK_HINV_GEN);
   gen->genid = _unur_set_genid(GENTYPE);
   SAMPLE = _unur_hinv_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_hinv_getSAMPLE_ARRAY(gen);
   gen->destroy = _unur_hinv_free;
   gen->clone = _unur_hinv_clone;
   gen->reinit = _unur_hinv_reinit;
@@ -372,10 +383,8 @@ _unur_hinv_clone( const struct unur_gen *gen )
   struct unur_gen *clone;
   CHECK_NULL(gen,NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,NULL);
   clone = _unur_generic_clone( gen, GENTYPE );
-  CLONE->intervals = _unur_xmalloc( GEN->N*(GEN->order+2) * sizeof(double) );
-  memcpy( CLONE->intervals, GEN->intervals, GEN->N*(GEN->order+2) * sizeof(double) );
-  CLONE->guide = _unur_xmalloc( GEN->guide_size * sizeof(int) );
-  memcpy( CLONE->guide, GEN->guide, GEN->guide_size * sizeof(int) );
+  CLONE->intervals = _unur_shared_ref( GEN->intervals );
+  CLONE->guide = _unur_shared_ref( GEN->guide );
   return clone;
 #undef CLONE
 } 
@@ -396,8 +405,8 @@ _unur_hinv_free( struct unur_gen *gen )
       free(iv);
     }
   }
-  if (GEN->intervals) free (GEN->intervals);
-  if (GEN->guide)     free (GEN->guide);
+  _unur_shared_free (GEN->intervals);
+  _unur_shared_free (GEN->guide);
   _unur_generic_free(gen);
 } 
 double
@@ -411,14 +420,46 @@ _unur_hinv_sample( struct unur_gen *gen )
   if (X>DISTR.trunc[1]) return DISTR.trunc[1];
   return X;
 } 
+int
+_unur_hinv_sample_array( struct unur_gen *gen, double *X, int n )
+{ 
+  UNUR_URNG *urng;
+  double *ivs;
+  int *guide;
+  double U,x,Umin,Ud,tl,tr;
+  int guide_size,width,order,i,i0,k;
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
+  urng = gen->urng;
+  ivs = GEN->intervals;
+  guide = GEN->guide;
+  guide_size = GEN->guide_size;
+  order = GEN->order;
+  width = order+2;
+  Umin = GEN->Umin;
+  Ud = GEN->Umax - GEN->Umin;
+  tl = DISTR.trunc[0];
+  tr = DISTR.trunc[1];
+  for (k=0; k<n; k++) {
+    U = Umin + _unur_call_urng(urng) * Ud;
+    i = i0 = guide[(int) (guide_size*U)];
+    while (U > ivs[i+width])
+      i += width;
+    _unur_gen_count_n(gen,n_search,(i-i0)/width);
+    U = (U-ivs[i])/(ivs[i+width] - ivs[i]);
+    x = _unur_hinv_eval_polynomial( U, ivs+i+1, order );
+    X[k] = (x<tl) ? tl : ((x>tr) ? tr : x);
+  }
+  return UNUR_SUCCESS;
+} 
 double
 _unur_hinv_eval_approxinvcdf( const struct unur_gen *gen, double u )
 { 
-  int i;
+  int i,i0;
   CHECK_NULL(gen,UNUR_INFINITY);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_INFINITY);
-  i =  GEN->guide[(int) (GEN->guide_size*u)];
+  i = i0 = GEN->guide[(int) (GEN->guide_size*u)];
   while (u > GEN->intervals[i+GEN->order+2])
     i += GEN->order+2;
+  _unur_gen_count_n(gen,n_search,(i-i0)/(GEN->order+2));
   u = (u-GEN->intervals[i])/(GEN->intervals[i+GEN->order+2] - GEN->intervals[i]);
   return _unur_hinv_eval_polynomial( u, GEN->intervals+i+1, GEN->order );
 } 
@@ -447,6 +488,40 @@ unur_hinv_eval_approxinvcdf( const struct unur_gen *gen, double u )
   return x;
 } 
 int
+unur_hinv_eval_approxinvcdf_sorted( const struct unur_gen *gen, const double *U, double *X, int n )
+{ 
+  double *ivs;
+  double u,x,Umin,Ud,tl,tr;
+  int width,order,i,j;
+  _unur_check_NULL( GENTYPE, gen, UNUR_ERR_NULL );
+  if ( gen->method != UNUR_METH_HINV ) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"");
+    return UNUR_ERR_GEN_INVALID;
+  }
+  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
+  ivs = GEN->intervals;
+  order = GEN->order;
+  width = order+2;
+  Umin = GEN->Umin;
+  Ud = GEN->Umax - GEN->Umin;
+  tl = DISTR.trunc[0];
+  tr = DISTR.trunc[1];
+  i = 0;
+  for (j=0; j<n; j++) {
+    if (! (U[j]>0. && U[j]<1.)) {
+      X[j] = unur_hinv_eval_approxinvcdf(gen,U[j]);
+      continue;
+    }
+    u = Umin + U[j] * Ud;
+    while (u > ivs[i+width])
+      i += width;
+    u = (u-ivs[i])/(ivs[i+width] - ivs[i]);
+    x = _unur_hinv_eval_polynomial( u, ivs+i+1, order );
+    X[j] = (x<tl) ? tl : ((x>tr) ? tr : x);
+  }
+  return UNUR_SUCCESS;
+} 
+int
 unur_hinv_estimate_error( const UNUR_GEN *gen, int samplesize, double *max_error, double *MAE )
 { 
   _unur_check_NULL(GENTYPE, gen, UNUR_ERR_NULL);  
@@ -513,8 +588,10 @@ _unur_hinv_create_table( struct unur_gen *gen )
   int i, error_count_shortinterval=0;
   double Fx;
   CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
+  _unur_gen_phase_begin(gen,"cut-off search");
   if (_unur_hinv_find_boundary(gen) != UNUR_SUCCESS)
     return UNUR_ERR_GEN_DATA;
+  _unur_gen_phase_end(gen);
   if (GEN->stp) {
     iv = GEN->iv;
     for (i=0; i<GEN->n_stp; i++) {
@@ -741,7 +818,7 @@ _unur_hinv_list_to_array( struct unur_gen *gen )
   struct unur_hinv_interval *iv, *next;
   CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
   GEN->intervals = 
-    _unur_xrealloc( GEN->intervals, GEN->N*(GEN->order+2)*sizeof(double) );
+    _unur_shared_realloc( GEN->intervals, GEN->N*(GEN->order+2)*sizeof(double) );
   i = 0;
   for (iv=GEN->iv; iv!=NULL; iv=next) {
     GEN->intervals[i] = iv->u;
@@ -760,7 +837,7 @@ _unur_hinv_make_guide_table( struct unur_gen *gen )
   CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_HINV_GEN,UNUR_ERR_COOKIE);
   GEN->guide_size = (int) (GEN->N * GEN->guide_factor);
   if (GEN->guide_size <= 0) GEN->guide_size = 1; 
-  GEN->guide = _unur_xrealloc( GEN->guide, GEN->guide_size * sizeof(int) );
+  GEN->guide = _unur_shared_realloc( GEN->guide, GEN->guide_size * sizeof(int) );
   imax = (GEN->N-2) * (GEN->order+2);
 # define u(i)  (GEN->intervals[(i)+GEN->order+2])
   i = 0;
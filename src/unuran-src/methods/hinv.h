@@ -10,5 +10,6 @@ int unur_hinv_set_guidefactor( UNUR_PAR *parameters, double factor );
 int unur_hinv_set_max_intervals( UNUR_PAR *parameters, int max_ivs );
 int unur_hinv_get_n_intervals( const UNUR_GEN *generator );
 double unur_hinv_eval_approxinvcdf( const UNUR_GEN *generator, double u );
+int unur_hinv_eval_approxinvcdf_sorted( const UNUR_GEN *generator, const double *U, double *X, int n );
 int unur_hinv_chg_truncated( UNUR_GEN *generator, double left, double right );
 int unur_hinv_estimate_error( const UNUR_GEN *generator, int samplesize, double *max_error, double *MAE );
@@ -11,7 +11,8 @@
 #include <utils/mrou_rectangle_struct.h>
 #include <utils/mrou_rectangle_source.h>
 #include "unur_methods_source.h"
-#include "arou.h"
+#include <distributions/unur_distributions_source.h>
+#include "cstd.h"
 #include "x_gen.h"
 #include "x_gen_source.h"
 #include "hitro.h"
@@ -672,8 +673,8 @@ _unur_hitro_normalgen( struct unur_gen *gen )
 {
   struct unur_gen   *normalgen;
   struct unur_distr *normaldistr = unur_distr_normal(NULL,0);
-  struct unur_par   *normalpar = unur_arou_new( normaldistr );
-  unur_arou_set_usedars( normalpar, TRUE );
+  struct unur_par   *normalpar = unur_cstd_new( normaldistr );
+  unur_cstd_set_variant( normalpar, _unur_stdgen_normal_zigg_variant );
   normalgen = unur_init( normalpar );
   _unur_distr_free( normaldistr );
   if (normalgen == NULL) {
@@ -688,10 +689,8 @@ _unur_hitro_normalgen( struct unur_gen *gen )
 void
 _unur_hitro_random_unitvector( struct unur_gen *gen, double *direction )
 {
-  int i;
   do {
-    for (i=0; i<GEN->dim+1; i++)
-      direction[i] = unur_sample_cont(GEN_NORMAL);
+    unur_sample_cont_array(GEN_NORMAL, direction, GEN->dim+1);
     _unur_vector_normalize(GEN->dim+1, direction);
   } while (!_unur_isfinite(direction[0]));
 } 
@@ -54,7 +54,7 @@ static void _unur_itdr_info( struct unur_gen *gen, int help );
 #define O2I(x)    ( GEN->sign * ((x)-GEN->pole) )
 #define PDF(x)    ( _unur_cont_PDF(I2O(x), gen->distr) )
 #define dPDF(x)   ( GEN->sign * _unur_cont_dPDF(I2O(x), gen->distr) )
-#define PDFo(x)   ( _unur_cont_PDF((x), gen->distr) )
+#define PDFo(x)   (_unur_gen_count(gen,n_pdf), ( _unur_cont_PDF((x), gen->distr) ))
 #define dPDFo(x)  ( _unur_cont_dPDF((x), gen->distr) )
 #define logPDF(x)   ( _unur_cont_logPDF(I2O(x), gen->distr) )   
 #define dlogPDF(x)  ( GEN->sign * _unur_cont_dlogPDF(I2O(x), gen->distr) )  
@@ -382,6 +382,7 @@ _unur_itdr_sample( struct unur_gen *gen )
     X = I2O(X);
     if (Y <= PDFo(X))
       return X;
+    _unur_gen_count(gen,n_reject);
   }
 } 
 double
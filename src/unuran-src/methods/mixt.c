@@ -16,7 +16,10 @@
 #include "mixt.h"
 #include "mixt_struct.h"
 #define MIXT_VARFLAG_INVERSION   0x004u    
+#define MIXT_VARFLAG_GROUPED     0x008u    
 #define MIXT_SET_USEINVERSION     0x001u    
+#define MIXT_SET_GROUPED          0x002u    
+#define MIXT_BLOCK_SIZE  (1024)  
 #define GENTYPE "MIXT"          
 static struct unur_gen *_unur_mixt_init( struct unur_par *par );
 static struct unur_gen *_unur_mixt_create( struct unur_par *par );
@@ -25,6 +28,8 @@ static struct unur_gen *_unur_mixt_clone( const struct unur_gen *gen );
 static void _unur_mixt_free( struct unur_gen *gen);
 static double _unur_mixt_sample( struct unur_gen *gen );
 static double _unur_mixt_sample_inv( struct unur_gen *gen );
+static int _unur_mixt_sample_array( struct unur_gen *gen, double *X, int n );
+static int _unur_mixt_sample_comp( struct unur_gen *comp, double *X, int *K, int n );
 static struct unur_gen *_unur_mixt_indexgen( const double *prob, int n_prob );
 static int _unur_mixt_get_boundary( struct unur_gen *gen );
 #ifdef UNUR_ENABLE_LOGGING
@@ -37,6 +42,7 @@ static void _unur_mixt_info( struct unur_gen *gen, int help );
 #define GEN       ((struct unur_mixt_gen*)gen->datap) 
 #define DISTR     gen->distr->data.cont 
 #define SAMPLE    gen->sample.cont      
+#define SAMPLE_ARRAY  gen->sample_array.cont
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define INDEX     gen_aux
@@ -46,6 +52,9 @@ static void _unur_mixt_info( struct unur_gen *gen, int help );
 #define _unur_mixt_getSAMPLE(gen) \
    ( ((gen)->variant & MIXT_VARFLAG_INVERSION) \
      ? _unur_mixt_sample_inv : _unur_mixt_sample )
+#define _unur_mixt_getSAMPLE_ARRAY(gen) \
+   ( ((gen)->variant & MIXT_VARFLAG_INVERSION) \
+     ? NULL : _unur_mixt_sample_array )
 struct unur_par *
 unur_mixt_new( int n, const double *prob, struct unur_gen **comp )
 {
@@ -79,6 +88,17 @@ unur_mixt_set_useinversion( struct unur_par *par, int useinversion )
   par->set |= MIXT_SET_USEINVERSION;
   return UNUR_SUCCESS;
 } 
+int
+unur_mixt_set_grouped( struct unur_par *par, int grouped )
+{
+  _unur_check_NULL( GENTYPE, par, UNUR_ERR_NULL );
+  _unur_check_par_object( par, MIXT );
+  par->variant = (grouped)
+    ? (par->variant | MIXT_VARFLAG_GROUPED)
+    : (par->variant & (~MIXT_VARFLAG_GROUPED));
+  par->set |= MIXT_SET_GROUPED;
+  return UNUR_SUCCESS;
+} 
 struct unur_gen *
 _unur_mixt_init( struct unur_par *par )
 {
@@ -96,6 +116,7 @@ _unur_mixt_init( struct unur_par *par )
   gen->COMP = _unur_xmalloc( gen->N_COMP * sizeof(struct unur_gen *));
   for (i=0; i<gen->N_COMP; i++)
     gen->COMP[i] = unur_gen_clone(PAR->comp[i]);
+  GEN->count = _unur_xmalloc( (gen->N_COMP+1) * sizeof(int) );
   _unur_par_free(par);
   if (_unur_mixt_check_par(gen) != UNUR_SUCCESS) {
     _unur_mixt_free(gen); return NULL;
@@ -119,10 +140,12 @@ _unur_mixt_create( struct unur_par *par )
   gen->genid = _unur_set_genid(GENTYPE);
   gen->distr = unur_distr_cont_new();
   SAMPLE = _unur_mixt_getSAMPLE(gen);
+  SAMPLE_ARRAY = _unur_mixt_getSAMPLE_ARRAY(gen);
   gen->destroy = _unur_mixt_free;
   gen->clone = _unur_mixt_clone;
   gen->reinit = NULL;    
   GEN->is_inversion = (gen->variant & MIXT_VARFLAG_INVERSION) ? TRUE : FALSE;
+  GEN->count = NULL;
 #ifdef UNUR_ENABLE_INFO
   gen->info = _unur_mixt_info;
 #endif
@@ -163,6 +186,7 @@ _unur_mixt_clone( const struct unur_gen *gen )
   struct unur_gen *clone;
   CHECK_NULL(gen,NULL);  COOKIE_CHECK(gen,CK_MIXT_GEN,NULL);
   clone = _unur_generic_clone( gen, GENTYPE );
+  CLONE->count = _unur_xmalloc( (gen->N_COMP+1) * sizeof(int) );
   return clone;
 #undef CLONE
 } 
@@ -176,6 +200,7 @@ _unur_mixt_free( struct unur_gen *gen )
     return; }
   COOKIE_CHECK(gen,CK_MIXT_GEN,RETURN_VOID);
   SAMPLE = NULL;   
+  if (GEN->count) free(GEN->count);
   _unur_generic_free(gen);
 } 
 double
@@ -195,6 +220,57 @@ _unur_mixt_sample( struct unur_gen *gen )
     return (comp->sample.cont(comp));
   }
 } 
+int
+_unur_mixt_sample_array( struct unur_gen *gen, double *X, int n )
+{
+  int J[MIXT_BLOCK_SIZE], K[MIXT_BLOCK_SIZE];
+  double Y[MIXT_BLOCK_SIZE];
+  int *count;
+  int i, j, i0, nb, n_comp;
+  int status = UNUR_SUCCESS;
+  CHECK_NULL(gen,UNUR_ERR_NULL);  COOKIE_CHECK(gen,CK_MIXT_GEN,UNUR_ERR_COOKIE);
+  if (n <= 0) return UNUR_SUCCESS;
+  count = GEN->count;
+  n_comp = gen->N_COMP;
+  if (gen->variant & MIXT_VARFLAG_GROUPED) {
+    memset( count, 0, (n_comp+1) * sizeof(int) );
+    for (i0=0; i0<n && status==UNUR_SUCCESS; i0+=MIXT_BLOCK_SIZE) {
+      nb = _unur_min(MIXT_BLOCK_SIZE, n-i0);
+      status = unur_sample_discr_array(gen->INDEX, J, nb);
+      for (i=0; i<nb; i++) ++count[J[i]];
+    }
+    for (j=0, i0=0; j<n_comp && status==UNUR_SUCCESS; i0+=count[j++])
+      status = _unur_mixt_sample_comp(gen->COMP[j], X+i0, K, count[j]);
+  }
+  else {
+    for (i0=0; i0<n && status==UNUR_SUCCESS; i0+=MIXT_BLOCK_SIZE) {
+      nb = _unur_min(MIXT_BLOCK_SIZE, n-i0);
+      status = unur_sample_discr_array(gen->INDEX, J, nb);
+      memset( count, 0, (n_comp+1) * sizeof(int) );
+      for (i=0; i<nb; i++) ++count[J[i]+1];
+      for (j=0; j<n_comp; j++) count[j+1] += count[j];
+      for (j=0; j<n_comp && status==UNUR_SUCCESS; j++)
+	status = _unur_mixt_sample_comp(gen->COMP[j], Y+count[j], K, count[j+1]-count[j]);
+      for (i=0; i<nb; i++)
+	X[i0+i] = Y[count[J[i]]++];
+    }
+  }
+  return status;
+} 
+int
+_unur_mixt_sample_comp( struct unur_gen *comp, double *X, int *K, int n )
+{
+  int i, i0, nb;
+  int status = UNUR_SUCCESS;
+  if ((comp->method & UNUR_MASK_TYPE) != UNUR_METH_DISCR)
+    return (n > 0) ? unur_sample_cont_array(comp, X, n) : UNUR_SUCCESS;
+  for (i0=0; i0<n && status==UNUR_SUCCESS; i0+=MIXT_BLOCK_SIZE) {
+    nb = _unur_min(MIXT_BLOCK_SIZE, n-i0);
+    status = unur_sample_discr_array(comp, K, nb);
+    for (i=0; i<nb; i++) X[i0+i] = (double) K[i];
+  }
+  return status;
+} 
 double
 _unur_mixt_sample_inv( struct unur_gen *gen )
 {
@@ -371,6 +447,9 @@ _unur_mixt_info( struct unur_gen *gen, int help )
   _unur_string_append(info,"   select component = method DGT\n");
   _unur_string_append(info,"   inversion method = %s\n",
 		      (GEN->is_inversion) ? "TRUE" : "FALSE");
+  if (!GEN->is_inversion)
+    _unur_string_append(info,"   batch sampling   = %s order\n",
+			(gen->variant & MIXT_VARFLAG_GROUPED) ? "grouped" : "random");
   _unur_string_append(info,"\n");
   _unur_string_append(info,"performance characteristics: depends on components\n");
   _unur_string_append(info,"\n");
@@ -381,6 +460,11 @@ _unur_mixt_info( struct unur_gen *gen, int help )
       _unur_string_append(info,"on\n");
     else
       _unur_string_append(info,"off  [default]\n");
+    _unur_string_append(info,"   grouped = ");
+    if (gen->variant & MIXT_VARFLAG_GROUPED)
+      _unur_string_append(info,"on\n");
+    else
+      _unur_string_append(info,"off  [default]\n");
   }
 } 
 #endif   
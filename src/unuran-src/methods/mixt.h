@@ -3,4 +3,5 @@
 
 UNUR_PAR *unur_mixt_new( int n, const double *prob, UNUR_GEN **comp );
 int unur_mixt_set_useinversion( UNUR_PAR *parameters, int useinv );
+int unur_mixt_set_grouped( UNUR_PAR *parameters, int grouped );
 double unur_mixt_eval_invcdf( const UNUR_GEN *generator, double u );
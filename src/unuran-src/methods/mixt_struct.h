@@ -8,4 +8,5 @@ struct unur_mixt_par {
 };
 struct unur_mixt_gen { 
   int is_inversion;             
+  int *count;                   
 };
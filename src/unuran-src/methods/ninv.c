@@ -60,8 +60,8 @@ static void _unur_ninv_info( struct unur_gen *gen, int help );
 #define GEN       ((struct unur_ninv_gen*)gen->datap) 
 #define DISTR     gen->distr->data.cont 
 #define SAMPLE    gen->sample.cont      
-#define PDF(x)    _unur_cont_PDF((x),(gen->distr))    
-#define CDF(x)    _unur_cont_CDF((x),(gen->distr))    
+#define PDF(x)    (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
+#define CDF(x)    (_unur_gen_count(gen,n_cdf), _unur_cont_CDF((x),(gen->distr)))
 static UNUR_SAMPLING_ROUTINE_CONT *
 _unur_ninv_getSAMPLE( struct unur_gen *gen )
 {
@@ -48,7 +48,7 @@ static void _unur_nrou_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define PDF(x)    _unur_cont_PDF((x),(gen->distr))    
+#define PDF(x)    (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
 #define _unur_nrou_getSAMPLE(gen) \
    ( ((gen)->variant & NROU_VARFLAG_VERIFY) \
      ? _unur_nrou_sample_check : _unur_nrou_sample )
@@ -250,8 +250,10 @@ _unur_nrou_sample( struct unur_gen *gen )
       X = U/V + GEN->center;
     else
       X = U/pow(V,GEN->r) + GEN->center;
-    if ( (X < DISTR.BD_LEFT) || (X > DISTR.BD_RIGHT) )
+    if ( (X < DISTR.BD_LEFT) || (X > DISTR.BD_RIGHT) ) {
+      _unur_gen_count(gen,n_reject);
       continue;
+    }
     if (_unur_isone(GEN->r)) {
       if (V*V <= PDF(X)) 
         return X;
@@ -260,6 +262,7 @@ _unur_nrou_sample( struct unur_gen *gen )
       if (V <= pow(PDF(X), 1./(1.+GEN->r)) )
         return X;
     }
+    _unur_gen_count(gen,n_reject);
   }
 } 
 double
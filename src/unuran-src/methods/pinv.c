@@ -23,6 +23,8 @@
 #define PINV_UTOL_CORRECTION  (0.05)
 #define PINV_MAX_ITER_IVS    (10 * GEN->max_ivs)
 #define PINV_GUIDE_FACTOR  (1)
+#define PINV_EVAL_BLOCK    (64)
+#define PINV_PARALLEL_SEGMENTS  (4)
 #define PINV_VARIANT_PDF      0x0010u   
 #define PINV_VARIANT_UPOINTS  0x0040u   
 #define PINV_VARIANT_KEEPCDF  0x0080u   
@@ -41,6 +43,7 @@
 #define PINV_SET_VARIANT        0x0040u  
 #define PINV_SET_MAX_IVS        0x0080u  
 #define PINV_SET_KEEPCDF        0x0100u  
+#define PINV_SET_THREADS        0x0200u  
 #define PINV_SET_N_EXTRA_TP     0x4000u  
 #define GENTYPE "PINV"         
 static struct unur_gen *_unur_pinv_init (struct unur_par *par);
@@ -50,8 +53,11 @@ static struct unur_gen *_unur_pinv_clone (const struct unur_gen *gen);
 static void _unur_pinv_free (struct unur_gen *gen);
 static int _unur_pinv_make_guide_table (struct unur_gen *gen);
 static double _unur_pinv_eval_PDF (double x, struct unur_gen *gen);
+static int _unur_pinv_eval_PDF_array (const double *x, double *fx, int n, struct unur_gen *gen);
 static double _unur_pinv_sample (struct unur_gen *gen);
+static int _unur_pinv_sample_array (struct unur_gen *gen, double *X, int n);
 static double _unur_pinv_eval_approxinvcdf (const struct unur_gen *gen, double u);
+static void _unur_pinv_eval_approxinvcdf_block (const struct unur_gen *gen, const double *U, double *X, int n);
 static int _unur_pinv_preprocessing (struct unur_gen *gen);
 static int _unur_pinv_relevant_support (struct unur_gen *gen);
 static double _unur_pinv_searchborder (struct unur_gen *gen, double x0, double bound,
@@ -65,6 +71,12 @@ static int _unur_pinv_computational_domain_CDF (struct unur_gen *gen);
 static double _unur_pinv_cut_CDF( struct unur_gen *gen, double dom, double x0, double ul, double uu );
 static double _unur_pinv_Udiff (struct unur_gen *gen, double x, double h, double *fx);
 static int _unur_pinv_create_table( struct unur_gen *gen );
+static int _unur_pinv_create_intervals( struct unur_gen *gen, double h, int left_free, int right_free,
+					int *iter, int *n_incr_h, int *n_decr_h, int *n_use_linear );
+#ifdef _OPENMP
+static int _unur_pinv_create_table_parallel( struct unur_gen *gen,
+					     int *iter, int *n_incr_h, int *n_decr_h, int *n_use_linear );
+#endif
 static int _unur_pinv_chebyshev_points (double *pt, int order, int smooth);
 static int _unur_pinv_newton_cpoints (double *xval, int order, struct unur_pinv_interval *iv, 
 				      double h, double *chebyshev, int smooth, int use_upoints);
@@ -72,7 +84,7 @@ static int _unur_pinv_newton_create (struct unur_gen *gen, struct unur_pinv_inte
 				     double *xval, int smooth);
 static int _unur_pinv_linear_create (struct unur_gen *gen, struct unur_pinv_interval *iv, 
 				     double *xval);
-static double _unur_pinv_newton_eval (double q, double *ui, double *zi, int order);
+static double _unur_pinv_newton_eval (double q, const double *ui, const double *zi, int order);
 static double _unur_pinv_newton_maxerror (struct unur_gen *gen, struct unur_pinv_interval *iv, double *xval);
 static double _unur_pinv_linear_maxerror (struct unur_gen *gen, struct unur_pinv_interval *iv);
 static double _unur_pinv_maxerror_extra (struct unur_gen *gen, struct unur_pinv_interval *iv, double *xval);
@@ -80,6 +92,7 @@ static int _unur_pinv_newton_testpoints (double *utest, double ui[], int order);
 static int _unur_pinv_cubic_hermite_is_monotone(struct unur_gen *gen, double *ui, double *zi, double *xval);
 static int _unur_pinv_interval( struct unur_gen *gen, int i, double x, double cdfx );
 static int _unur_pinv_lastinterval( struct unur_gen *gen );
+static int _unur_pinv_compact_table( struct unur_gen *gen );
 #ifdef UNUR_ENABLE_LOGGING
 static void _unur_pinv_debug_init_start (const struct unur_gen *gen);
 static void _unur_pinv_debug_init (const struct unur_gen *gen, int ok);
@@ -99,10 +112,12 @@ static void _unur_pinv_info( struct unur_gen *gen, int help );
 #define GEN       ((struct unur_pinv_gen*)gen->datap) 
 #define DISTR     gen->distr->data.cont 
 #define SAMPLE    gen->sample.cont      
+#define SAMPLE_ARRAY  gen->sample_array.cont
 #define PDF(x)  (_unur_pinv_eval_PDF((x),(gen)))      
 #define dPDF(x) (_unur_cont_dPDF((x),(gen->distr)))   
-#define CDF(x)  (_unur_cont_CDF((x),(gen->distr)))    
+#define CDF(x)  (_unur_gen_count(gen,n_cdf), _unur_cont_CDF((x),(gen->distr)))    
 #define _unur_pinv_getSAMPLE(gen)  (_unur_pinv_sample)
+#define _unur_pinv_getSAMPLE_ARRAY(gen)  (_unur_pinv_sample_array)
 #include "pinv_newset.ch"
 #include "pinv_init.ch"
 #include "pinv_sample.ch"
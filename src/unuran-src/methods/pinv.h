@@ -12,8 +12,11 @@ int unur_pinv_set_usecdf( UNUR_PAR *parameters );
 int unur_pinv_set_boundary( UNUR_PAR *parameters, double left, double right );
 int unur_pinv_set_searchboundary( UNUR_PAR *parameters, int left, int right );
 int unur_pinv_set_max_intervals( UNUR_PAR *parameters, int max_ivs );
+int unur_pinv_set_threads( UNUR_PAR *parameters, int threads );
 int unur_pinv_get_n_intervals( const UNUR_GEN *generator ); 
 int unur_pinv_set_keepcdf( UNUR_PAR *parameters, int keepcdf);
 double unur_pinv_eval_approxinvcdf( const UNUR_GEN *generator, double u );
+int unur_pinv_eval_approxinvcdf_array( const UNUR_GEN *generator, const double *U, double *X, int n );
+int unur_pinv_eval_approxinvcdf_sorted( const UNUR_GEN *generator, const double *U, double *X, int n );
 double unur_pinv_eval_approxcdf( const UNUR_GEN *generator, double x );
 int unur_pinv_estimate_error( const UNUR_GEN *generator, int samplesize, double *max_error, double *MAE );
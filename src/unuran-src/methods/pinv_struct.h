@@ -11,6 +11,7 @@ struct unur_pinv_par {
   int sright;              
   int max_ivs;             
   int n_extra_testpoints;  
+  int threads;             
 };
 struct unur_pinv_interval {
   double *ui;  
@@ -32,6 +33,9 @@ struct unur_pinv_gen {
   double  bleft;           
   double  bright;          
   struct unur_pinv_interval *iv; 
+  double *cdfi;            
+  double *xi;              
+  double *coeff;           
   int n_ivs;               
   int max_ivs;             
   double  bleft_par;       
@@ -42,4 +46,5 @@ struct unur_pinv_gen {
   int sright;              
   double area;              
   struct unur_lobatto_table *aCDF; 
+  int threads;             
 };
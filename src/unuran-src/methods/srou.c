@@ -47,7 +47,7 @@ static void _unur_srou_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define PDF(x)    _unur_cont_PDF((x),(gen->distr))    
+#define PDF(x)    (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
 static UNUR_SAMPLING_ROUTINE_CONT *
 _unur_srou_getSAMPLE( struct unur_gen *gen )
 {
@@ -341,8 +341,10 @@ _unur_srou_sample( struct unur_gen *gen )
     V = GEN->vl + _unur_call_urng(gen->urng) * (GEN->vr - GEN->vl);
     X = V/U;
     x = X + DISTR.mode;
-    if ( (x < DISTR.BD_LEFT) || (x > DISTR.BD_RIGHT) )
+    if ( (x < DISTR.BD_LEFT) || (x > DISTR.BD_RIGHT) ) {
+      _unur_gen_count(gen,n_reject);
       continue;
+    }
     if ( (gen->variant & SROU_VARFLAG_SQUEEZE) &&
 	 (X >= GEN->xl) && 
 	 (X <= GEN->xr ) && 
@@ -353,6 +355,7 @@ _unur_srou_sample( struct unur_gen *gen )
     }
     if (U*U <= PDF(x))
       return x;
+    _unur_gen_count(gen,n_reject);
   }
 } 
 double
@@ -374,6 +377,7 @@ _unur_srou_sample_mirror( struct unur_gen *gen )
     fnx  = (x < DISTR.BD_LEFT || x > DISTR.BD_RIGHT) ? 0. : PDF(x);
     if (uu <= fx + fnx)
       return x;
+    _unur_gen_count(gen,n_reject);
   }
 } 
 double
@@ -452,10 +456,13 @@ _unur_gsrou_sample( struct unur_gen *gen )
     U *= GEN->um;
     Ur = pow(U,GEN->r);
     X = V/Ur + DISTR.mode;
-    if ( (X < DISTR.BD_LEFT) || (X > DISTR.BD_RIGHT) )
+    if ( (X < DISTR.BD_LEFT) || (X > DISTR.BD_RIGHT) ) {
+      _unur_gen_count(gen,n_reject);
       continue;
+    }
     if (Ur*U <= PDF(X))
       return X;
+    _unur_gen_count(gen,n_reject);
   }
 } 
 double
@@ -42,7 +42,7 @@ static void _unur_ssr_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define PDF(x)    _unur_cont_PDF((x),(gen->distr))    
+#define PDF(x)    (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
 #define _unur_ssr_getSAMPLE(gen) \
    ( ((gen)->variant & SSR_VARFLAG_VERIFY) \
      ? _unur_ssr_sample_check : _unur_ssr_sample )
@@ -303,6 +303,7 @@ _unur_ssr_sample( struct unur_gen *gen )
     X += DISTR.mode;
     if (y <= PDF(X))
       return X;
+    _unur_gen_count(gen,n_reject);
   }
 } 
 double
@@ -60,6 +60,7 @@ _unur_tabl_split_interval( struct unur_gen *gen, struct unur_tabl_interval *iv,
 static int
 _unur_tabl_improve_hat( struct unur_gen *gen, struct unur_tabl_interval *iv, 
 			double x, double fx );
+static int _unur_tabl_refine( struct unur_gen *gen, double x, double fx );
 static int _unur_tabl_make_guide_table( struct unur_gen *gen );
 static double _unur_tabl_eval_cdfhat( struct unur_gen *gen, double x );
 #ifdef UNUR_ENABLE_LOGGING
@@ -79,7 +80,7 @@ static void _unur_tabl_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define PDF(x)    _unur_cont_PDF((x),(gen->distr))    
+#define PDF(x)    (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
 static UNUR_SAMPLING_ROUTINE_CONT *
 _unur_tabl_getSAMPLE( struct unur_gen *gen )
 {
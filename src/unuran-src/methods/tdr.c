@@ -51,6 +51,13 @@ static double _unur_tdr_ps_sample( struct unur_gen *generator );
 static double _unur_tdr_ps_sample_check( struct unur_gen *generator );
 static double _unur_tdr_ia_sample( struct unur_gen *generator );
 static double _unur_tdr_ia_sample_check( struct unur_gen *generator );
+static double _unur_tdr_ps_sample_frozen( struct unur_gen *generator );
+static double _unur_tdr_ia_sample_frozen( struct unur_gen *generator );
+static int _unur_tdr_gw_sample_array( struct unur_gen *generator, double *X, int n );
+static int _unur_tdr_ps_sample_array( struct unur_gen *generator, double *X, int n );
+static int _unur_tdr_ia_sample_array( struct unur_gen *generator, double *X, int n );
+static int _unur_tdr_ps_sample_array_frozen( struct unur_gen *generator, double *X, int n );
+static int _unur_tdr_ia_sample_array_frozen( struct unur_gen *generator, double *X, int n );
 static double _unur_tdr_gw_eval_invcdfhat( const struct unur_gen *generator, double u,
 					   double *hx, double *fx, double *sqx,
 					   struct unur_tdr_interval **iv,
@@ -89,6 +96,9 @@ static int _unur_tdr_gw_improve_hat( struct unur_gen *gen, struct unur_tdr_inter
 static int _unur_tdr_ps_improve_hat( struct unur_gen *gen, struct unur_tdr_interval *iv, 
 				     double x, double fx);
 static int _unur_tdr_make_guide_table( struct unur_gen *gen );
+static int _unur_tdr_make_frozen( struct unur_gen *gen );
+static void _unur_tdr_free_frozen( struct unur_gen *gen );
+static int _unur_tdr_refine( struct unur_gen *gen, double x, double fx );
 #ifdef UNUR_ENABLE_LOGGING
 static void _unur_tdr_debug_init_start( const struct unur_gen *gen );
 static void _unur_tdr_debug_init_finished( const struct unur_gen *gen );
@@ -133,10 +143,12 @@ static void _unur_tdr_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define PDF(x)     _unur_cont_PDF((x),(gen->distr))      
+#define SAMPLE_ARRAY  gen->sample_array.cont
+#define PDF(x)     (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
 #define dPDF(x)    _unur_cont_dPDF((x),(gen->distr))     
-#define logPDF(x)  _unur_cont_logPDF((x),(gen->distr))   
+#define logPDF(x)  (_unur_gen_count(gen,n_pdf), _unur_cont_logPDF((x),(gen->distr)))
 #define dlogPDF(x) _unur_cont_dlogPDF((x),(gen->distr))  
+#define _unur_tdr_interval_free(iv)  _unur_gen_release(gen,(iv),sizeof(struct unur_tdr_interval))
 static UNUR_SAMPLING_ROUTINE_CONT *
 _unur_tdr_getSAMPLE( struct unur_gen *gen )
 {
@@ -144,10 +156,29 @@ _unur_tdr_getSAMPLE( struct unur_gen *gen )
   case TDR_VARIANT_GW:    
     return (gen->variant & TDR_VARFLAG_VERIFY) ? _unur_tdr_gw_sample_check : _unur_tdr_gw_sample;
   case TDR_VARIANT_IA:    
-    return (gen->variant & TDR_VARFLAG_VERIFY) ? _unur_tdr_ia_sample_check : _unur_tdr_ia_sample;
+    if (gen->variant & TDR_VARFLAG_VERIFY)
+      return _unur_tdr_ia_sample_check;
+    return (GEN->fiv) ? _unur_tdr_ia_sample_frozen : _unur_tdr_ia_sample;
   case TDR_VARIANT_PS:    
   default:
-    return (gen->variant & TDR_VARFLAG_VERIFY) ? _unur_tdr_ps_sample_check : _unur_tdr_ps_sample;
+    if (gen->variant & TDR_VARFLAG_VERIFY)
+      return _unur_tdr_ps_sample_check;
+    return (GEN->fiv) ? _unur_tdr_ps_sample_frozen : _unur_tdr_ps_sample;
+  }
+} 
+static UNUR_SAMPLING_ROUTINE_CONT_ARRAY *
+_unur_tdr_getSAMPLE_ARRAY( struct unur_gen *gen )
+{
+  if (gen->variant & TDR_VARFLAG_VERIFY)
+    return NULL;
+  switch (gen->variant & TDR_VARMASK_VARIANT) {
+  case TDR_VARIANT_GW:    
+    return _unur_tdr_gw_sample_array;
+  case TDR_VARIANT_IA:    
+    return (GEN->fiv) ? _unur_tdr_ia_sample_array_frozen : _unur_tdr_ia_sample_array;
+  case TDR_VARIANT_PS:    
+  default:
+    return (GEN->fiv) ? _unur_tdr_ps_sample_array_frozen : _unur_tdr_ps_sample_array;
   }
 } 
 #include "tdr_newset.ch"
@@ -28,3 +28,4 @@ int unur_tdr_set_pedantic( UNUR_PAR *parameters, int pedantic );
 double unur_tdr_eval_invcdfhat( const UNUR_GEN *generator, double u, 
 				double *hx, double *fx, double *sqx );
 int _unur_tdr_is_ARS_running( const UNUR_GEN *generator );
+int unur_tdr_freeze_hat( UNUR_GEN *generator );
@@ -33,6 +33,16 @@ struct unur_tdr_interval {
   unsigned cookie;              
 #endif
 };
+struct unur_tdr_frozen {
+  double  x;                    
+  double  fx;                    
+  double  Tfx;                   
+  double  dTfx;                 
+  double  sq;                   
+  double  Acum;                 
+  double  Ahat;                 
+  double  Ahatr;                
+};
 struct unur_tdr_gen { 
   double  Atotal;               
   double  Asqueeze;             
@@ -46,6 +56,8 @@ struct unur_tdr_gen {
   struct unur_tdr_interval **guide; 
   int     guide_size;           
   double  guide_factor;         
+  struct unur_tdr_frozen *fiv;  
+  int    *fguide;               
   double  center;               
   double *starting_cpoints;     
   int     n_starting_cpoints;   
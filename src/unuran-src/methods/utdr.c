@@ -43,7 +43,7 @@ static void _unur_utdr_info( struct unur_gen *gen, int help );
 #define BD_LEFT   domain[0]             
 #define BD_RIGHT  domain[1]             
 #define SAMPLE    gen->sample.cont           
-#define PDF(x)    _unur_cont_PDF((x),(gen->distr))    
+#define PDF(x)    (_unur_gen_count(gen,n_pdf), _unur_cont_PDF((x),(gen->distr)))
 #define _unur_utdr_getSAMPLE(gen) \
    ( ((gen)->variant & UTDR_VARFLAG_VERIFY) \
      ? _unur_utdr_sample_check : _unur_utdr_sample )
@@ -313,6 +313,7 @@ _unur_utdr_sample( struct unur_gen *gen )
       }
     }
     if (v <= PDF(x)) return x; 
+    _unur_gen_count(gen,n_reject);
   }
 } 
 double
@@ -1,6 +1,7 @@
 /* Copyright (c) 2000-2024 Wolfgang Hoermann and Josef Leydold */
 /* Department of Statistics and Mathematics, WU Wien, Austria  */
 
+#include <time.h>
 #include <unur_source.h>
 #include <distr/distr_source.h>
 #include <distr/matr.h>
@@ -17,10 +18,21 @@
 #include "unur_methods_source.h"
 #include "x_gen.h"
 #include "x_gen_source.h"
+#define _UNUR_DEFERRED_SIZE  (1000)
+static void _unur_gen_share_free( struct unur_gen *gen );
+static int _unur_quantile_is_sorted( const double *U, int n );
+static unsigned long _unur_gen_urng_calls( const struct unur_gen *gen );
+static void _unur_gen_count_sample( struct unur_gen *gen, unsigned long mark, int n );
+static double _unur_gen_clock( void );
+static void _unur_gen_profile_charge( struct unur_gen *gen );
+static int _unur_default_profiling = FALSE;
 struct unur_gen *unur_init( struct unur_par *par )
 {                
+  struct unur_gen *gen;
   _unur_check_NULL(NULL,par,NULL);
-  return (par->init(par));
+  gen = par->init(par);
+  if (gen) _unur_gen_profile_stop(gen);
+  return gen;
 } 
 int unur_reinit( struct unur_gen *gen )
 {
@@ -34,6 +46,7 @@ int unur_reinit( struct unur_gen *gen )
     _unur_error(gen->genid,UNUR_ERR_NO_REINIT,"");
     status = UNUR_ERR_NO_REINIT;
   }
+  gen->sample_array.cont = NULL;
   switch (gen->method & UNUR_MASK_TYPE) {
   case UNUR_METH_DISCR:
     gen->sample.discr = _unur_sample_discr_error;
@@ -57,26 +70,112 @@ int unur_reinit( struct unur_gen *gen )
 int
 unur_sample_discr( struct unur_gen *gen )
 {
+  int K;
+  unsigned long mark;
   CHECK_NULL(gen,0);
-  return (gen->sample.discr(gen));
+  if (gen->counters == NULL)
+    return (gen->sample.discr(gen));
+  mark = _unur_gen_urng_calls(gen);
+  K = gen->sample.discr(gen);
+  _unur_gen_count_sample(gen,mark,1);
+  return K;
 } 
 double
 unur_sample_cont( struct unur_gen *gen )
 {
+  double X;
+  unsigned long mark;
   CHECK_NULL(gen,UNUR_INFINITY);
-  return (gen->sample.cont(gen));
+  if (gen->counters == NULL)
+    return (gen->sample.cont(gen));
+  mark = _unur_gen_urng_calls(gen);
+  X = gen->sample.cont(gen);
+  _unur_gen_count_sample(gen,mark,1);
+  return X;
+} 
+int
+unur_sample_discr_array( struct unur_gen *gen, int *K, int n )
+{
+  int i;
+  int status = UNUR_SUCCESS;
+  unsigned long mark = 0ul;
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  CHECK_NULL(K,UNUR_ERR_NULL);
+  if (gen->counters) mark = _unur_gen_urng_calls(gen);
+  if (gen->sample_array.discr)
+    status = gen->sample_array.discr(gen,K,n);
+  else
+    for (i=0; i<n; i++)
+      K[i] = gen->sample.discr(gen);
+  if (gen->counters) _unur_gen_count_sample(gen,mark,n);
+  return status;
+} 
+int
+unur_sample_cont_array( struct unur_gen *gen, double *X, int n )
+{
+  int i;
+  int status = UNUR_SUCCESS;
+  unsigned long mark = 0ul;
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  CHECK_NULL(X,UNUR_ERR_NULL);
+  if (gen->counters) mark = _unur_gen_urng_calls(gen);
+  if (gen->sample_array.cont)
+    status = gen->sample_array.cont(gen,X,n);
+  else
+    for (i=0; i<n; i++)
+      X[i] = gen->sample.cont(gen);
+  if (gen->counters) _unur_gen_count_sample(gen,mark,n);
+  return status;
 } 
 int
 unur_sample_vec( struct unur_gen *gen, double *vector )
 {
+  int status;
+  unsigned long mark;
   CHECK_NULL(gen,UNUR_ERR_NULL);
-  return (gen->sample.cvec(gen,vector));
+  if (gen->counters == NULL)
+    return (gen->sample.cvec(gen,vector));
+  mark = _unur_gen_urng_calls(gen);
+  status = gen->sample.cvec(gen,vector);
+  _unur_gen_count_sample(gen,mark,1);
+  return status;
+} 
+int
+unur_sample_vec_array( struct unur_gen *gen, double *X, int n )
+{
+  int i,j,dim;
+  int status = UNUR_SUCCESS;
+  unsigned long mark = 0ul;
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  CHECK_NULL(X,UNUR_ERR_NULL);
+  if (gen->counters) mark = _unur_gen_urng_calls(gen);
+  if (gen->sample_array.cvec) {
+    status = gen->sample_array.cvec(gen,X,n);
+    if (gen->counters) _unur_gen_count_sample(gen,mark,n);
+    return status;
+  }
+  dim = gen->distr->dim;
+  for (i=0; i<n; i++, X+=dim) {
+    if (gen->sample.cvec(gen,X) != UNUR_SUCCESS) {
+      for (j=0; j<dim; j++) X[j] = UNUR_INFINITY;
+      status = UNUR_FAILURE;
+    }
+  }
+  if (gen->counters) _unur_gen_count_sample(gen,mark,n);
+  return status;
 } 
 int
 unur_sample_matr( struct unur_gen *gen, double *matrix )
 {
+  int status;
+  unsigned long mark;
   CHECK_NULL(gen,UNUR_ERR_NULL);
-  return (gen->sample.matr(gen,matrix));
+  if (gen->counters == NULL)
+    return (gen->sample.matr(gen,matrix));
+  mark = _unur_gen_urng_calls(gen);
+  status = gen->sample.matr(gen,matrix);
+  _unur_gen_count_sample(gen,mark,1);
+  return status;
 } 
 double
 unur_quantile ( struct unur_gen *gen, double U )
@@ -108,6 +207,36 @@ unur_quantile ( struct unur_gen *gen, double U )
   return UNUR_INFINITY;
 } 
 int
+unur_quantile_array ( struct unur_gen *gen, const double *U, double *X, int n )
+{
+  int i;
+  CHECK_NULL(gen,UNUR_ERR_NULL);
+  if (_unur_quantile_is_sorted(U,n)) {
+    switch (gen->method) {
+    case UNUR_METH_HINV:
+      return unur_hinv_eval_approxinvcdf_sorted(gen,U,X,n);
+    case UNUR_METH_PINV:
+      return unur_pinv_eval_approxinvcdf_sorted(gen,U,X,n);
+    case UNUR_METH_DGT:
+      return unur_dgt_eval_invcdf_sorted(gen,U,X,n);
+    }
+  }
+  if (gen->method == UNUR_METH_PINV)
+    return unur_pinv_eval_approxinvcdf_array(gen,U,X,n);
+  for (i=0; i<n; i++)
+    X[i] = (_unur_isnan(U[i])) ? U[i] : unur_quantile(gen,U[i]);
+  return UNUR_SUCCESS;
+} 
+int
+_unur_quantile_is_sorted ( const double *U, int n )
+{
+  int i;
+  for (i=1; i<n; i++)
+    if (! (U[i-1] <= U[i]))
+      return FALSE;
+  return TRUE;
+} 
+int
 unur_gen_is_inversion ( const struct unur_gen *gen )
 {
   if (gen==NULL) return FALSE;
@@ -215,6 +344,284 @@ unur_gen_clone( const struct unur_gen *gen )
   _unur_check_NULL( "Clone", gen->clone, NULL );
   return (gen->clone(gen));
 } 
+struct unur_gen *
+unur_gen_share( struct unur_gen *gen )
+{
+  struct unur_gen *shared;
+  _unur_check_NULL( "Share", gen, NULL );
+  if (gen->refine == NULL || gen->deferred != NULL ||
+      gen->gen_aux != NULL || gen->gen_aux_list != NULL) {
+    _unur_error(gen->genid,UNUR_ERR_GEN_INVALID,"generator object cannot be shared");
+    return NULL;
+  }
+  shared = _unur_xmalloc( sizeof(struct unur_gen) );
+  memcpy( shared, gen, sizeof(struct unur_gen) );
+  shared->deferred = _unur_xmalloc( sizeof(struct unur_gen_deferred) );
+  shared->deferred->base = gen;
+  shared->deferred->x = _unur_xmalloc( 2 * _UNUR_DEFERRED_SIZE * sizeof(double) );
+  shared->deferred->fx = shared->deferred->x + _UNUR_DEFERRED_SIZE;
+  shared->deferred->n = 0;
+  shared->deferred->size = _UNUR_DEFERRED_SIZE;
+  shared->deferred->failed = FALSE;
+  shared->destroy = _unur_gen_share_free;
+  shared->clone = NULL;
+  shared->reinit = NULL;
+  shared->counters = NULL;
+  if (gen->counters) unur_gen_set_counters(shared,TRUE);
+  shared->profile = NULL;
+#ifdef UNUR_ENABLE_INFO
+  shared->infostr = NULL;
+#endif
+  return shared;
+} 
+int
+unur_gen_share_merge( struct unur_gen *shared )
+{
+  struct unur_gen *gen;
+  int i;
+  int status = UNUR_SUCCESS;
+  _unur_check_NULL( "Share", shared, UNUR_ERR_NULL );
+  if (shared->deferred == NULL) {
+    _unur_error(shared->genid,UNUR_ERR_GEN_INVALID,"not a shared generator object");
+    return UNUR_ERR_GEN_INVALID;
+  }
+  gen = shared->deferred->base;
+  for (i=0; i<shared->deferred->n && status==UNUR_SUCCESS; i++)
+    status = gen->refine(gen, shared->deferred->x[i], shared->deferred->fx[i]);
+  shared->deferred->n = 0;
+  if (shared->deferred->failed) {
+    _unur_warning(gen->genid,UNUR_ERR_MALLOC,"construction points dropped");
+    shared->deferred->failed = FALSE;
+    if (status==UNUR_SUCCESS) status = UNUR_ERR_MALLOC;
+  }
+  if (shared->counters) {
+    unur_gen_add_counters(gen,shared);
+    unur_gen_reset_counters(shared);
+  }
+  shared->sample = gen->sample;
+  shared->sample_array = gen->sample_array;
+  return status;
+} 
+int
+_unur_gen_defer( struct unur_gen *gen, double x, double fx )
+{
+  struct unur_gen_deferred *deferred = gen->deferred;
+  double *x_new;
+  if (deferred->failed)
+    return UNUR_SUCCESS;
+  if (deferred->n >= deferred->size) {
+    x_new = realloc( deferred->x, 4 * deferred->size * sizeof(double) );
+    if (x_new == NULL) {
+      deferred->failed = TRUE;
+      return UNUR_SUCCESS;
+    }
+    deferred->x = x_new;
+    memcpy( deferred->x + 2 * deferred->size, deferred->x + deferred->size, deferred->n * sizeof(double) );
+    deferred->size *= 2;
+    deferred->fx = deferred->x + deferred->size;
+  }
+  deferred->x[deferred->n] = x;
+  deferred->fx[deferred->n] = fx;
+  ++(deferred->n);
+  return UNUR_SUCCESS;
+} 
+void
+_unur_gen_share_free( struct unur_gen *gen )
+{
+  free(gen->deferred->x);
+  free(gen->deferred);
+  if (gen->counters) free(gen->counters);
+#ifdef UNUR_ENABLE_INFO
+  if (gen->infostr) _unur_string_free(gen->infostr);  
+#endif
+  free(gen);
+} 
+int
+unur_gen_set_counters( struct unur_gen *gen, int count )
+{
+  _unur_check_NULL( "counters", gen, UNUR_ERR_NULL );
+  if (count) {
+    if (gen->counters == NULL) {
+      gen->counters = _unur_xmalloc( sizeof(struct unur_gen_counters) );
+      memset( gen->counters, 0, sizeof(struct unur_gen_counters) );
+    }
+  }
+  else if (gen->counters) {
+    free(gen->counters);
+    gen->counters = NULL;
+  }
+  return UNUR_SUCCESS;
+} 
+int
+unur_gen_get_counters( const struct unur_gen *gen, double *counts )
+{
+  _unur_check_NULL( "counters", gen, UNUR_ERR_NULL );
+  _unur_check_NULL( gen->genid, counts, UNUR_ERR_NULL );
+  if (gen->counters == NULL)
+    return UNUR_FAILURE;
+  counts[0] = gen->counters->n_sample;
+  counts[1] = gen->counters->n_urng;
+  counts[2] = gen->counters->n_pdf;
+  counts[3] = gen->counters->n_cdf;
+  counts[4] = gen->counters->n_reject;
+  counts[5] = gen->counters->n_refine;
+  counts[6] = gen->counters->n_search;
+  return UNUR_SUCCESS;
+} 
+int
+unur_gen_reset_counters( struct unur_gen *gen )
+{
+  _unur_check_NULL( "counters", gen, UNUR_ERR_NULL );
+  if (gen->counters == NULL)
+    return UNUR_FAILURE;
+  memset( gen->counters, 0, sizeof(struct unur_gen_counters) );
+  return UNUR_SUCCESS;
+} 
+int
+unur_gen_add_counters( struct unur_gen *gen, const struct unur_gen *other )
+{
+  _unur_check_NULL( "counters", gen, UNUR_ERR_NULL );
+  _unur_check_NULL( gen->genid, other, UNUR_ERR_NULL );
+  if (gen->counters == NULL || other->counters == NULL)
+    return UNUR_FAILURE;
+  gen->counters->n_sample += other->counters->n_sample;
+  gen->counters->n_urng   += other->counters->n_urng;
+  gen->counters->n_pdf    += other->counters->n_pdf;
+  gen->counters->n_cdf    += other->counters->n_cdf;
+  gen->counters->n_reject += other->counters->n_reject;
+  gen->counters->n_refine += other->counters->n_refine;
+  gen->counters->n_search += other->counters->n_search;
+  return UNUR_SUCCESS;
+} 
+unsigned long
+_unur_gen_urng_calls( const struct unur_gen *gen )
+{
+  unsigned long n = (gen->urng) ? gen->urng->n_calls : 0ul;
+  if (gen->urng_aux && gen->urng_aux != gen->urng)
+    n += gen->urng_aux->n_calls;
+  return n;
+} 
+void
+_unur_gen_count_sample( struct unur_gen *gen, unsigned long mark, int n )
+{
+  gen->counters->n_sample += n;
+  gen->counters->n_urng += (double) (_unur_gen_urng_calls(gen) - mark);
+} 
+int
+unur_set_default_profiling( int profile )
+{
+  _unur_default_profiling = (profile) ? TRUE : FALSE;
+  return UNUR_SUCCESS;
+} 
+int
+unur_gen_get_n_setup_phases( const struct unur_gen *gen )
+{
+  _unur_check_NULL( "profile", gen, 0 );
+  return (gen->profile) ? gen->profile->n_phases : 0;
+} 
+const char *
+unur_gen_get_setup_phase( const struct unur_gen *gen, int phase, double *stats )
+{
+  struct unur_gen_phase *ph;
+  _unur_check_NULL( "profile", gen, NULL );
+  _unur_check_NULL( gen->genid, stats, NULL );
+  if (gen->profile == NULL || phase < 0 || phase >= gen->profile->n_phases) {
+    _unur_error(gen->genid,UNUR_ERR_GENERIC,"invalid setup phase");
+    return NULL;
+  }
+  ph = gen->profile->phase + phase;
+  stats[0] = ph->time;
+  stats[1] = ph->n_pdf;
+  stats[2] = ph->n_cdf;
+  return ph->name;
+} 
+void
+_unur_gen_profile_start( struct unur_gen *gen )
+{
+  struct unur_gen_profile *prof;
+  prof = gen->profile = _unur_xmalloc( sizeof(struct unur_gen_profile) );
+  prof->n_phases = 0;
+  prof->depth = 0;
+  prof->recording = TRUE;
+  prof->own_counters = (gen->counters == NULL);
+  if (prof->own_counters) unur_gen_set_counters(gen,TRUE);
+  prof->t_start = prof->t_mark = _unur_gen_clock();
+  prof->pdf_start = prof->pdf_mark = gen->counters->n_pdf;
+  prof->cdf_start = prof->cdf_mark = gen->counters->n_cdf;
+} 
+void
+_unur_gen_profile_stop( struct unur_gen *gen )
+{
+  struct unur_gen_profile *prof = gen->profile;
+  struct unur_gen_phase *ph;
+  if (prof == NULL || !prof->recording) return;
+  while (prof->depth > 0)
+    _unur_gen_profile_end(gen);
+  ph = prof->phase + prof->n_phases;
+  ph->name = "total";
+  ph->time = _unur_gen_clock() - prof->t_start;
+  ph->n_pdf = gen->counters->n_pdf - prof->pdf_start;
+  ph->n_cdf = gen->counters->n_cdf - prof->cdf_start;
+  ++(prof->n_phases);
+  prof->recording = FALSE;
+  if (prof->own_counters) unur_gen_set_counters(gen,FALSE);
+} 
+void
+_unur_gen_profile_begin( struct unur_gen *gen, const char *name )
+{
+  struct unur_gen_profile *prof = gen->profile;
+  int i;
+  if (!prof->recording) return;
+  _unur_gen_profile_charge(gen);
+  for (i=0; i<prof->n_phases; i++)
+    if (strcmp(prof->phase[i].name,name)==0) break;
+  if (i == prof->n_phases) {
+    if (i < UNUR_GEN_MAX_PHASES-1) {
+      prof->phase[i].name = name;
+      prof->phase[i].time = prof->phase[i].n_pdf = prof->phase[i].n_cdf = 0.;
+      ++(prof->n_phases);
+    }
+    else
+      i = -1;
+  }
+  if (prof->depth < UNUR_GEN_MAX_PHASES)
+    prof->stack[prof->depth++] = i;
+} 
+void
+_unur_gen_profile_end( struct unur_gen *gen )
+{
+  struct unur_gen_profile *prof = gen->profile;
+  if (!prof->recording || prof->depth <= 0) return;
+  _unur_gen_profile_charge(gen);
+  --(prof->depth);
+} 
+void
+_unur_gen_profile_charge( struct unur_gen *gen )
+{
+  struct unur_gen_profile *prof = gen->profile;
+  struct unur_gen_phase *ph;
+  double t = _unur_gen_clock();
+  if (prof->depth > 0 && prof->stack[prof->depth-1] >= 0) {
+    ph = prof->phase + prof->stack[prof->depth-1];
+    ph->time += t - prof->t_mark;
+    ph->n_pdf += gen->counters->n_pdf - prof->pdf_mark;
+    ph->n_cdf += gen->counters->n_cdf - prof->cdf_mark;
+  }
+  prof->t_mark = t;
+  prof->pdf_mark = gen->counters->n_pdf;
+  prof->cdf_mark = gen->counters->n_cdf;
+} 
+double
+_unur_gen_clock( void )
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1.e-9 * ts.tv_nsec;
+#else
+  return ((double) clock()) / CLOCKS_PER_SEC;
+#endif
+} 
 struct unur_par *
 _unur_par_new( size_t s)
 {
@@ -253,9 +660,16 @@ _unur_generic_create( struct unur_par *par, size_t s )
     gen->distr = (par->distr) ? _unur_distr_clone(par->distr) : NULL;
   else
     gen->distr = (struct unur_distr *) par->distr;
+  gen->sample_array.cont = NULL;    
   gen->destroy = NULL;               
   gen->clone = NULL;                
   gen->reinit = NULL;                
+  gen->refine = NULL;               
+  gen->deferred = NULL;             
+  gen->arena = NULL;                
+  gen->counters = NULL;             
+  gen->profile = NULL;              
+  if (_unur_default_profiling) _unur_gen_profile_start(gen);
   gen->method = par->method;        
   gen->variant = par->variant;      
   gen->set = par->set;              
@@ -281,6 +695,10 @@ _unur_generic_clone( const struct unur_gen *gen, const char *type )
   clone->datap = _unur_xmalloc(gen->s_datap);
   memcpy (clone->datap, gen->datap, gen->s_datap);
   clone->genid = _unur_set_genid(type);
+  clone->arena = NULL;
+  clone->counters = NULL;
+  if (gen->counters) unur_gen_set_counters(clone,TRUE);
+  clone->profile = NULL;
 #ifdef UNUR_ENABLE_INFO
   clone->infostr = NULL;
 #endif
@@ -308,6 +726,9 @@ _unur_generic_free( struct unur_gen *gen )
     _unur_distr_free( gen->distr );
   _unur_free_genid(gen);
   COOKIE_CLEAR(gen);
+  _unur_arena_free(&(gen->arena));
+  if (gen->counters) free(gen->counters);
+  if (gen->profile) free(gen->profile);
   free(gen->datap);
 #ifdef UNUR_ENABLE_INFO
   if (gen->infostr) _unur_string_free(gen->infostr);  
@@ -369,3 +790,49 @@ _unur_gen_list_free( struct unur_gen **gen_list, int n_gen_list )
     if (gen_list[i]) _unur_free(gen_list[i]);
   free (gen_list);
 } 
+struct _unur_params_row {
+  const double *p;
+  int n_params;
+  int idx;
+};
+static int
+_unur_params_row_cmp( const void *a, const void *b )
+{
+  const struct _unur_params_row *ra = a;
+  const struct _unur_params_row *rb = b;
+  int j;
+  for (j=0; j<ra->n_params; j++) {
+    if (ra->p[j] < rb->p[j]) return -1;
+    if (ra->p[j] > rb->p[j]) return 1;
+  }
+  return ((ra->idx < rb->idx) ? -1 : (ra->idx > rb->idx) ? 1 : 0);
+} 
+int *
+_unur_gen_sort_params( const double *params, int n_params, int n )
+{
+  struct _unur_params_row *rows;
+  int *idx;
+  int i,j;
+  for (i=0; i<n*n_params; i++)
+    if (!_unur_isfinite(params[i])) return NULL;
+  rows = _unur_xmalloc( n * sizeof(struct _unur_params_row) );
+  for (i=0; i<n; i++) {
+    rows[i].p = params + i*n_params;
+    rows[i].n_params = n_params;
+    rows[i].idx = i;
+  }
+  qsort( rows, (size_t) n, sizeof(struct _unur_params_row), _unur_params_row_cmp );
+  idx = _unur_xmalloc( n * sizeof(int) );
+  for (j=0; j<n; j++)
+    idx[j] = rows[j].idx;
+  free(rows);
+  return idx;
+} 
+int
+_unur_gen_params_equal( const double *params, int n_params, int i, int j )
+{
+  int k;
+  for (k=0; k<n_params; k++)
+    if (params[i*n_params+k] != params[j*n_params+k]) return FALSE;
+  return TRUE;
+} 
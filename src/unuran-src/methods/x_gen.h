@@ -5,9 +5,13 @@ UNUR_GEN *unur_init( UNUR_PAR *parameters );
 int unur_reinit( UNUR_GEN *generator );
 int    unur_sample_discr(UNUR_GEN *generator);
 double unur_sample_cont(UNUR_GEN *generator);
+int    unur_sample_discr_array(UNUR_GEN *generator, int *K, int n);
+int    unur_sample_cont_array(UNUR_GEN *generator, double *X, int n);
 int    unur_sample_vec(UNUR_GEN *generator, double *vector);
+int    unur_sample_vec_array(UNUR_GEN *generator, double *X, int n);
 int    unur_sample_matr(UNUR_GEN *generator, double *matrix);
 double unur_quantile ( UNUR_GEN *generator, double U );
+int unur_quantile_array ( UNUR_GEN *generator, const double *U, double *X, int n );
 void  unur_free( UNUR_GEN *generator );
 const char *unur_gen_info( UNUR_GEN *generator, int help );
 int unur_get_dimension( const UNUR_GEN *generator );
@@ -17,4 +21,14 @@ int unur_gen_is_inversion ( const UNUR_GEN *gen );
 UNUR_DISTR *unur_get_distr( const UNUR_GEN *generator );
 int unur_set_use_distr_privatecopy( UNUR_PAR *parameters, int use_privatecopy );
 UNUR_GEN *unur_gen_clone( const UNUR_GEN *gen );
+UNUR_GEN *unur_gen_share( UNUR_GEN *gen );
+int unur_gen_share_merge( UNUR_GEN *shared );
+#define UNUR_GEN_N_COUNTERS (7)
+int unur_gen_set_counters( UNUR_GEN *generator, int count );
+int unur_gen_get_counters( const UNUR_GEN *generator, double *counts );
+int unur_gen_reset_counters( UNUR_GEN *generator );
+int unur_gen_add_counters( UNUR_GEN *generator, const UNUR_GEN *other );
+int unur_set_default_profiling( int profile );
+int unur_gen_get_n_setup_phases( const UNUR_GEN *generator );
+const char *unur_gen_get_setup_phase( const UNUR_GEN *generator, int phase, double *stats );
 void unur_par_free( UNUR_PAR *par);
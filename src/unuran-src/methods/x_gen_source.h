@@ -1,10 +1,13 @@
 /* Copyright (c) 2000-2024 Wolfgang Hoermann and Josef Leydold */
 /* Department of Statistics and Mathematics, WU Wien, Austria  */
 
-#define _unur_init(par)               (par)->init(par)
+#define _unur_init(par)               unur_init(par)
 #define _unur_sample_discr(gen)       (gen)->sample.discr(gen)
 #define _unur_sample_cont(gen)        (gen)->sample.cont(gen)
 #define _unur_sample_vec(gen,vector)  (gen)->sample.cvec(gen,vector)
+#define _unur_sample_cont_array(gen,X,n)   unur_sample_cont_array((gen),(X),(n))
+#define _unur_sample_discr_array(gen,K,n)  unur_sample_discr_array((gen),(K),(n))
+#define _unur_sample_vec_array(gen,X,n)    unur_sample_vec_array((gen),(X),(n))
 #define _unur_free(gen)               do {if(gen) (gen)->destroy(gen);} while(0)
 #define _unur_gen_is_discr(gen) ( ((gen)->distr->type == UNUR_DISTR_DISCR) ? 1 : 0 )
 #define _unur_gen_is_cont(gen)  ( ((gen)->distr->type == UNUR_DISTR_CONT)  ? 1 : 0 )
@@ -20,6 +23,19 @@ struct unur_gen *_unur_generic_create( struct unur_par *par, size_t s );
 struct unur_gen *_unur_generic_clone( const struct unur_gen *gen, const char *type );
 #define _unur_gen_clone(gen)    ((gen)->clone(gen))
 void _unur_generic_free( struct unur_gen *gen );
+#define _unur_gen_alloc(gen,size)        _unur_arena_alloc(&((gen)->arena),(size))
+#define _unur_gen_release(gen,ptr,size)  _unur_arena_release((gen)->arena,(ptr),(size))
+#define _unur_gen_count(gen,what)  ((gen)->counters ? (void)(++((gen)->counters->what)) : (void)0)
+#define _unur_gen_count_n(gen,what,n)  ((gen)->counters ? (void)((gen)->counters->what += (n)) : (void)0)
+void _unur_gen_profile_start( struct unur_gen *gen );
+void _unur_gen_profile_stop( struct unur_gen *gen );
+void _unur_gen_profile_begin( struct unur_gen *gen, const char *name );
+void _unur_gen_profile_end( struct unur_gen *gen );
+#define _unur_gen_phase_begin(gen,name)  ((gen)->profile ? _unur_gen_profile_begin((gen),(name)) : (void)0)
+#define _unur_gen_phase_end(gen)  ((gen)->profile ? _unur_gen_profile_end(gen) : (void)0)
+int _unur_gen_defer( struct unur_gen *gen, double x, double fx );
 struct unur_gen **_unur_gen_list_set( struct unur_gen *gen, int n_gen_list );
 struct unur_gen **_unur_gen_list_clone( struct unur_gen **gen_list, int n_gen_list );
 void _unur_gen_list_free( struct unur_gen **gen_list, int n_gen_list );
+int *_unur_gen_sort_params( const double *params, int n_params, int n );
+int _unur_gen_params_equal( const double *params, int n_params, int i, int j );
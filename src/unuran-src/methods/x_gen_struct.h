@@ -4,6 +4,9 @@
 typedef double UNUR_SAMPLING_ROUTINE_CONT(struct unur_gen *gen);
 typedef int UNUR_SAMPLING_ROUTINE_DISCR(struct unur_gen *gen);
 typedef int UNUR_SAMPLING_ROUTINE_CVEC(struct unur_gen *gen, double *vec);
+typedef int UNUR_SAMPLING_ROUTINE_CONT_ARRAY(struct unur_gen *gen, double *X, int n);
+typedef int UNUR_SAMPLING_ROUTINE_DISCR_ARRAY(struct unur_gen *gen, int *K, int n);
+typedef int UNUR_SAMPLING_ROUTINE_CVEC_ARRAY(struct unur_gen *gen, double *X, int n);
 struct unur_par {
   void *datap;                
   size_t s_datap;             
@@ -20,6 +23,41 @@ struct unur_par {
   unsigned cookie;            
 #endif
 };
+struct unur_gen_counters {
+  double n_sample;            
+  double n_urng;              
+  double n_pdf;               
+  double n_cdf;               
+  double n_reject;            
+  double n_refine;            
+  double n_search;            
+};
+#define UNUR_GEN_MAX_PHASES (8)
+struct unur_gen_phase {
+  const char *name;           
+  double time;                
+  double n_pdf;               
+  double n_cdf;               
+};
+struct unur_gen_profile {
+  struct unur_gen_phase phase[UNUR_GEN_MAX_PHASES]; 
+  int n_phases;               
+  int stack[UNUR_GEN_MAX_PHASES]; 
+  int depth;                  
+  int recording;              
+  int own_counters;           
+  double t_start, t_mark;     
+  double pdf_start, pdf_mark; 
+  double cdf_start, cdf_mark; 
+};
+struct unur_gen_deferred {
+  struct unur_gen *base;      
+  double *x;                  
+  double *fx;                 
+  int n;                      
+  int size;                   
+  int failed;                 
+};
 struct unur_gen { 
   void *datap;                
   union {
@@ -28,6 +66,11 @@ struct unur_gen {
     UNUR_SAMPLING_ROUTINE_CVEC  *cvec;
     UNUR_SAMPLING_ROUTINE_CVEC  *matr;
   } sample;                   
+  union {
+    UNUR_SAMPLING_ROUTINE_CONT_ARRAY  *cont;
+    UNUR_SAMPLING_ROUTINE_DISCR_ARRAY *discr;
+    UNUR_SAMPLING_ROUTINE_CVEC_ARRAY  *cvec;
+  } sample_array;             
   UNUR_URNG *urng;            
   UNUR_URNG *urng_aux;        
   struct unur_distr *distr;   
@@ -45,6 +88,11 @@ struct unur_gen {
   void (*destroy)(struct unur_gen *gen);  
   struct unur_gen* (*clone)(const struct unur_gen *gen ); 
   int (*reinit)(struct unur_gen *gen);  
+  int (*refine)(struct unur_gen *gen, double x, double fx); 
+  struct unur_gen_deferred *deferred; 
+  struct unur_arena *arena;   
+  struct unur_gen_counters *counters; 
+  struct unur_gen_profile *profile; 
 #ifdef UNUR_ENABLE_INFO
   struct unur_string *infostr; 
   void (*info)(struct unur_gen *gen, int help); 
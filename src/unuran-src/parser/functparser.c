@@ -75,6 +75,14 @@ static struct ftreenode *_unur_fstr_create_node (const char *symb, double val, i
 static struct ftreenode *_unur_fstr_error_parse ( struct parser_data *pdata, int perrno, int line );
 static const char *_unur_fstr_error_code ( int perrno );
 static double _unur_fstr_eval_node (const struct ftreenode *node, double x);
+static struct ftreeprog *_unur_fstr_compile (const struct ftreenode *root);
+static int _unur_fstr_compile_node (struct ftreecode *code, const struct ftreenode *node,
+				    int *depth, int *max_depth);
+static int _unur_fstr_has_variable (const struct ftreenode *node);
+static void _unur_fstr_prog_free (struct ftreeprog *prog);
+static double _unur_fstr_eval_op (int op, int token, double l, double r);
+static double _unur_fstr_eval_prog (const struct ftreeprog *prog, double x);
+static struct ftreenode *_unur_fstr_dup_node (const struct ftreenode *node);
 static void _unur_fstr_error_deriv (const struct ftreenode *node, int line);
 static int _unur_fstr_node2string ( struct unur_string *output, const struct ftreenode *node,
 				    const char *variable, const char *function, int spaces );
@@ -94,6 +102,7 @@ static void _unur_fstr_debug_deriv (const struct ftreenode *funct,
 #include "functparser_scanner.ch"
 #include "functparser_parser.ch"
 #include "functparser_eval.ch"
+#include "functparser_prog.ch"
 #include "functparser_deriv.ch"
 #include "functparser_stringgen.ch"
 #include "functparser_debug.ch"
@@ -6,6 +6,8 @@
 struct ftreenode *_unur_fstr2tree ( const char *functstring );
 struct ftreenode *_unur_fstr2tree_DefFunct ( const char *functstring );
 double _unur_fstr_eval_tree ( const struct ftreenode *functtree_root, double x );
+int _unur_fstr_eval_tree_array ( const struct ftreenode *functtree_root,
+				 const double *x, double *fx, int n );
 struct ftreenode *_unur_fstr_dup_tree (const struct ftreenode *functtree_root);
 void _unur_fstr_free ( struct ftreenode *functtree_root );
 char *_unur_fstr_tree2string ( const struct ftreenode *functtree_root,
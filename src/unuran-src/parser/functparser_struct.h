@@ -1,6 +1,17 @@
 /* Copyright (c) 2000-2024 Wolfgang Hoermann and Josef Leydold */
 /* Department of Statistics and Mathematics, WU Wien, Austria  */
 
+struct ftreecode {
+  int             op;           
+  int             token;        
+  int             args;         
+  double          val;          
+};
+struct ftreeprog {
+  struct ftreecode *code;       
+  int             n_code;       
+  int             stack;        
+};
 struct ftreenode { 
   char            *symbol;      
   int             token;        
@@ -8,6 +19,7 @@ struct ftreenode {
   double          val;          
   struct ftreenode *left;       
   struct ftreenode *right;      
+  struct ftreeprog *prog;       
 #ifdef UNUR_COOKIES
   unsigned cookie;              
 #endif
@@ -2,6 +2,7 @@
 /* Department of Statistics and Mathematics, WU Wien, Austria  */
 
 #include <unur_source.h>
+#include <urng/urng.h>
 #include "urng_builtin.h"
 #define SEED10  (12345L)
 #define SEED11  (23456L)
@@ -75,3 +76,150 @@ unur_urng_MRG31k3p_reset (void *dummy ATTRIBUTE__UNUSED)
   x21 = x21_start;
   x22 = x22_start;
 } 
+#define MRG31K3P_M1  (2147483647UL)
+#define MRG31K3P_M2  (2147462579UL)
+#define MRG31K3P_NORM  (4.656612873077393e-10)
+struct unur_urng_MRG31k3p_state {
+  unsigned long x[6];         
+  unsigned long x_start[6];   
+  unsigned long x_sub[6];     
+};
+static double _unur_urng_MRG31k3p_r( void *state );
+static unsigned int _unur_urng_MRG31k3p_r_array( void *state, double *X, int dim );
+static void _unur_urng_MRG31k3p_r_seed( void *state, unsigned long seed );
+static void _unur_urng_MRG31k3p_r_reset( void *state );
+static void _unur_urng_MRG31k3p_r_nextsub( void *state );
+static void _unur_urng_MRG31k3p_r_resetsub( void *state );
+static void _unur_urng_MRG31k3p_r_delete( void *state );
+static void _unur_urng_MRG31k3p_jump( unsigned long *x );
+#define MRG31K3P_STEP(x,u)  do {					\
+    unsigned long yy1, yy2;						\
+    yy1 = ( ((((x)[1]) & 511UL) << 22) + (((x)[1]) >> 9)		\
+	    + ((((x)[2]) & 16777215UL) << 7) + (((x)[2]) >> 24) );	\
+    if (yy1 > MRG31K3P_M1) yy1 -= MRG31K3P_M1;				\
+    yy1 += (x)[2];							\
+    if (yy1 > MRG31K3P_M1) yy1 -= MRG31K3P_M1;				\
+    (x)[2] = (x)[1];  (x)[1] = (x)[0];  (x)[0] = yy1;			\
+    yy1 = ((((x)[3]) & 65535UL) << 15) + 21069UL * (((x)[3]) >> 16);	\
+    if (yy1 > MRG31K3P_M2) yy1 -= MRG31K3P_M2;				\
+    yy2 = ((((x)[5]) & 65535UL) << 15) + 21069UL * (((x)[5]) >> 16);	\
+    if (yy2 > MRG31K3P_M2) yy2 -= MRG31K3P_M2;				\
+    yy2 += (x)[5];							\
+    if (yy2 > MRG31K3P_M2) yy2 -= MRG31K3P_M2;				\
+    yy2 += yy1;								\
+    if (yy2 > MRG31K3P_M2) yy2 -= MRG31K3P_M2;				\
+    (x)[5] = (x)[4];  (x)[4] = (x)[3];  (x)[3] = yy2;			\
+    (u) = ( ((x)[0] <= (x)[3])						\
+	    ? (((x)[0] - (x)[3] + MRG31K3P_M1) * MRG31K3P_NORM)		\
+	    : (((x)[0] - (x)[3]) * MRG31K3P_NORM) );			\
+  } while (0)
+UNUR_URNG *
+unur_urng_MRG31k3p_new( unsigned long seed )
+{
+  static const unsigned long x_default[6] = {SEED10, SEED11, SEED12, SEED20, SEED21, SEED22};
+  struct unur_urng_MRG31k3p_state *s;
+  UNUR_URNG *urng;
+  int i;
+  s = _unur_xmalloc( sizeof(struct unur_urng_MRG31k3p_state) );
+  for (i=0; i<6; i++)
+    s->x[i] = s->x_start[i] = s->x_sub[i] = x_default[i];
+  urng = unur_urng_new( _unur_urng_MRG31k3p_r, s );
+  unur_urng_set_sample_array( urng, _unur_urng_MRG31k3p_r_array );
+  unur_urng_set_seed( urng, _unur_urng_MRG31k3p_r_seed );
+  unur_urng_set_reset( urng, _unur_urng_MRG31k3p_r_reset );
+  unur_urng_set_nextsub( urng, _unur_urng_MRG31k3p_r_nextsub );
+  unur_urng_set_resetsub( urng, _unur_urng_MRG31k3p_r_resetsub );
+  unur_urng_set_delete( urng, _unur_urng_MRG31k3p_r_delete );
+  if (seed != 0UL) 
+    unur_urng_seed( urng, seed );
+  return urng;
+} 
+double
+_unur_urng_MRG31k3p_r( void *state )
+{
+  struct unur_urng_MRG31k3p_state *s = state;
+  double u;
+  MRG31K3P_STEP(s->x,u);
+  return u;
+} 
+unsigned int
+_unur_urng_MRG31k3p_r_array( void *state, double *X, int dim )
+{
+  struct unur_urng_MRG31k3p_state *s = state;
+  unsigned long x[6];
+  int i;
+  for (i=0; i<6; i++) x[i] = s->x[i];
+  for (i=0; i<dim; i++)
+    MRG31K3P_STEP(x,X[i]);
+  for (i=0; i<6; i++) s->x[i] = x[i];
+  return (unsigned int) dim;
+} 
+void
+_unur_urng_MRG31k3p_r_seed( void *state, unsigned long seed )
+{
+  struct unur_urng_MRG31k3p_state *s = state;
+  int i;
+  seed %= MRG31K3P_M2;
+  if (seed==0) {
+    _unur_error("URNG.mrg31k3p",UNUR_ERR_GENERIC,"seed = 0");
+    return;
+  }
+  for (i=0; i<6; i++)
+    s->x[i] = s->x_start[i] = s->x_sub[i] = seed;
+} 
+void
+_unur_urng_MRG31k3p_r_reset( void *state )
+{
+  struct unur_urng_MRG31k3p_state *s = state;
+  int i;
+  for (i=0; i<6; i++)
+    s->x[i] = s->x_sub[i] = s->x_start[i];
+} 
+void
+_unur_urng_MRG31k3p_r_nextsub( void *state )
+{
+  struct unur_urng_MRG31k3p_state *s = state;
+  int i;
+  _unur_urng_MRG31k3p_jump( s->x_sub );
+  for (i=0; i<6; i++)
+    s->x[i] = s->x_sub[i];
+} 
+void
+_unur_urng_MRG31k3p_r_resetsub( void *state )
+{
+  struct unur_urng_MRG31k3p_state *s = state;
+  int i;
+  for (i=0; i<6; i++)
+    s->x[i] = s->x_sub[i];
+} 
+void
+_unur_urng_MRG31k3p_r_delete( void *state )
+{
+  free(state);
+} 
+void
+_unur_urng_MRG31k3p_jump( unsigned long *x )
+{
+  static const unsigned long A1p72[9] = {
+    1516919229UL,  758510237UL,  499121365UL,
+    1884998244UL, 1516919229UL,  335398200UL,
+     601897748UL, 1884998244UL,  358115744UL };
+  static const unsigned long A2p72[9] = {
+    1228857673UL, 1496414766UL,  954677935UL,
+    1133297478UL, 1407477216UL, 1496414766UL,
+    2002613992UL, 1639496704UL, 1407477216UL };
+  unsigned long long y;
+  unsigned long z[6];
+  int i;
+  for (i=0; i<3; i++) {
+    y = ( ((unsigned long long) A1p72[3*i] * x[0]) % MRG31K3P_M1
+	  + ((unsigned long long) A1p72[3*i+1] * x[1]) % MRG31K3P_M1
+	  + ((unsigned long long) A1p72[3*i+2] * x[2]) % MRG31K3P_M1 );
+    z[i] = (unsigned long) (y % MRG31K3P_M1);
+    y = ( ((unsigned long long) A2p72[3*i] * x[3]) % MRG31K3P_M2
+	  + ((unsigned long long) A2p72[3*i+1] * x[4]) % MRG31K3P_M2
+	  + ((unsigned long long) A2p72[3*i+2] * x[5]) % MRG31K3P_M2 );
+    z[3+i] = (unsigned long) (y % MRG31K3P_M2);
+  }
+  for (i=0; i<6; i++) x[i] = z[i];
+} 
@@ -0,0 +1,137 @@
+/* Copyright (c) 2000-2024 Wolfgang Hoermann and Josef Leydold */
+/* Department of Statistics and Mathematics, WU Wien, Austria  */
+
+#include <unur_source.h>
+#include <urng/urng.h>
+#include "urng_builtin.h"
+#include <stdint.h>
+#define PHILOX_M0  (0xD2511F53U)
+#define PHILOX_M1  (0xCD9E8D57U)
+#define PHILOX_W0  (0x9E3779B9U)
+#define PHILOX_W1  (0xBB67AE85U)
+#define PHILOX_ROUNDS  (10)
+struct unur_urng_philox_state {
+  uint32_t key[2];
+  uint32_t ctr[4];
+  double out[2];
+  int pos;
+};
+static void _unur_urng_philox_block( struct unur_urng_philox_state *s );
+static void _unur_urng_philox_delete( void *state );
+void
+_unur_urng_philox_block( struct unur_urng_philox_state *s )
+{
+  uint32_t c0 = s->ctr[0], c1 = s->ctr[1], c2 = s->ctr[2], c3 = s->ctr[3];
+  uint32_t k0 = s->key[0], k1 = s->key[1];
+  uint64_t p0, p1;
+  int r;
+  for (r=0; r<PHILOX_ROUNDS; r++) {
+    p0 = (uint64_t)PHILOX_M0 * c0;
+    p1 = (uint64_t)PHILOX_M1 * c2;
+    c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+    c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+    c1 = (uint32_t)p1;
+    c3 = (uint32_t)p0;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+  s->out[0] = ((double)(c0 >> 5) * 67108864. + (double)(c1 >> 6) + 0.5) * 1.1102230246251565e-16;
+  s->out[1] = ((double)(c2 >> 5) * 67108864. + (double)(c3 >> 6) + 0.5) * 1.1102230246251565e-16;
+  s->pos = 0;
+  if (++(s->ctr[0]) == 0) ++(s->ctr[1]);
+}
+UNUR_URNG *
+unur_urng_philox_new( unsigned long seed, unsigned long stream )
+{
+  struct unur_urng_philox_state *s;
+  UNUR_URNG *urng;
+  s = _unur_xmalloc( sizeof(struct unur_urng_philox_state) );
+  s->ctr[3] = (uint32_t) stream;
+  unur_urng_philox_seed(s,seed);
+  urng = unur_urng_new( unur_urng_philox, s );
+  unur_urng_set_sample_array( urng, unur_urng_philox_array );
+  unur_urng_set_reset( urng, unur_urng_philox_reset );
+  unur_urng_set_nextsub( urng, unur_urng_philox_nextsub );
+  unur_urng_set_resetsub( urng, unur_urng_philox_resetsub );
+  unur_urng_set_delete( urng, _unur_urng_philox_delete );
+  unur_urng_set_seed( urng, unur_urng_philox_seed );
+  urng->seed = seed;
+  return urng;
+}
+double
+unur_urng_philox( void *state )
+{
+  struct unur_urng_philox_state *s = state;
+  if (s->pos >= 2) _unur_urng_philox_block(s);
+  return s->out[(s->pos)++];
+}
+unsigned int
+unur_urng_philox_array( void *state, double *X, int dim )
+{
+  struct unur_urng_philox_state *s = state;
+  int i = 0;
+  while (i < dim && s->pos < 2)
+    X[i++] = s->out[(s->pos)++];
+  for (; i+1 < dim; i+=2) {
+    _unur_urng_philox_block(s);
+    X[i] = s->out[0];
+    X[i+1] = s->out[1];
+    s->pos = 2;
+  }
+  if (i < dim)
+    X[i++] = unur_urng_philox(s);
+  return (unsigned int) dim;
+}
+void
+unur_urng_philox_seed( void *state, unsigned long seed )
+{
+  struct unur_urng_philox_state *s = state;
+  s->key[0] = (uint32_t) seed;
+#if ULONG_MAX > 0xFFFFFFFFUL
+  s->key[1] = (uint32_t) (seed >> 32);
+#else
+  s->key[1] = 0U;
+#endif
+  s->ctr[2] = 0U;
+  unur_urng_philox_resetsub(s);
+}
+void
+unur_urng_philox_reset( void *state )
+{
+  struct unur_urng_philox_state *s = state;
+  s->ctr[2] = 0U;
+  unur_urng_philox_resetsub(s);
+}
+void
+unur_urng_philox_nextsub( void *state )
+{
+  struct unur_urng_philox_state *s = state;
+  ++(s->ctr[2]);
+  unur_urng_philox_resetsub(s);
+}
+void
+unur_urng_philox_resetsub( void *state )
+{
+  struct unur_urng_philox_state *s = state;
+  s->ctr[0] = s->ctr[1] = 0U;
+  s->pos = 2;
+}
+int
+unur_urng_philox_set_stream( UNUR_URNG *urng, unsigned long stream )
+{
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );
+  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  if (urng->sampleunif != unur_urng_philox) {
+    _unur_error("URNG.philox",UNUR_ERR_URNG,"not a Philox URNG");
+    return UNUR_ERR_URNG;
+  }
+  ((struct unur_urng_philox_state *) urng->state)->ctr[3] = (uint32_t) stream;
+  unur_urng_flush_buffer(urng);
+  unur_urng_philox_reset(urng->state);
+  return UNUR_SUCCESS;
+}
+void
+_unur_urng_philox_delete( void *state )
+{
+  free(state);
+}
@@ -6,6 +6,15 @@
 double unur_urng_MRG31k3p (void *dummy);
 void unur_urng_MRG31k3p_seed (void *dummy, unsigned long seed);
 void unur_urng_MRG31k3p_reset (void *dummy);
+UNUR_URNG *unur_urng_MRG31k3p_new( unsigned long seed );
+UNUR_URNG *unur_urng_philox_new( unsigned long seed, unsigned long stream );
+double unur_urng_philox (void *state);
+unsigned int unur_urng_philox_array (void *state, double *X, int dim);
+void unur_urng_philox_seed (void *state, unsigned long seed);
+void unur_urng_philox_reset (void *state);
+void unur_urng_philox_nextsub (void *state);
+void unur_urng_philox_resetsub (void *state);
+int unur_urng_philox_set_stream( UNUR_URNG *urng, unsigned long stream );
 double unur_urng_fish (void *dummy);
 void unur_urng_fish_seed (void *dummy, unsigned long seed);
 void unur_urng_fish_reset (void *dummy);
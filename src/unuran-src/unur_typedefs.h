@@ -13,6 +13,7 @@ struct unur_urng;
 typedef struct unur_urng  UNUR_URNG;
 #define UNUR_URNG_UNURAN 1
 typedef double UNUR_FUNCT_CONT  (double x, const struct unur_distr *distr);
+typedef int UNUR_FUNCT_CONT_ARRAY (const double *x, double *fx, int n, const struct unur_distr *distr);
 typedef double UNUR_FUNCT_DISCR (int x, const struct unur_distr *distr);
 typedef int    UNUR_IFUNCT_DISCR(double x, const struct unur_distr *distr);
 typedef double UNUR_FUNCT_CVEC (const double *x, struct unur_distr *distr);
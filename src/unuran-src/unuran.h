@@ -28,6 +28,7 @@ struct unur_urng;
 typedef struct unur_urng  UNUR_URNG;
 #define UNUR_URNG_UNURAN 1
 typedef double UNUR_FUNCT_CONT  (double x, const struct unur_distr *distr);
+typedef int UNUR_FUNCT_CONT_ARRAY (const double *x, double *fx, int n, const struct unur_distr *distr);
 typedef double UNUR_FUNCT_DISCR (int x, const struct unur_distr *distr);
 typedef int    UNUR_IFUNCT_DISCR(double x, const struct unur_distr *distr);
 typedef double UNUR_FUNCT_CVEC (const double *x, struct unur_distr *distr);
@@ -54,6 +55,7 @@ UNUR_URNG *unur_get_urng_aux( UNUR_GEN *generator );
 double unur_urng_sample (UNUR_URNG *urng);
 double unur_sample_urng (UNUR_GEN *gen);
 int unur_urng_sample_array (UNUR_URNG *urng, double *X, int dim);
+int unur_urng_sample_sorted (UNUR_URNG *urng, double *X, int n);
 int unur_urng_reset (UNUR_URNG *urng);
 #ifdef UNUR_URNG_UNURAN
 int unur_urng_sync (UNUR_URNG *urng);
@@ -70,6 +72,9 @@ int unur_gen_resetsub (UNUR_GEN *generator);
 UNUR_URNG *unur_urng_new( double (*sampleunif)(void *state), void *state );
 void unur_urng_free (UNUR_URNG *urng);
 int unur_urng_set_sample_array( UNUR_URNG *urng, unsigned int (*samplearray)(void *state, double *X, int dim) );
+int unur_urng_set_buffer( UNUR_URNG *urng, int size );
+int unur_urng_get_buffer_size( UNUR_URNG *urng );
+int unur_urng_flush_buffer( UNUR_URNG *urng );
 int unur_urng_set_sync( UNUR_URNG *urng, void (*sync)(void *state) );
 int unur_urng_set_seed( UNUR_URNG *urng, void (*setseed)(void *state, unsigned long seed) );
 int unur_urng_set_anti( UNUR_URNG *urng, void (*setanti)(void *state, int anti) );
@@ -84,6 +89,15 @@ int unur_urng_set_delete( UNUR_URNG *urng, void (*fpdelete)(void *state) );
 double unur_urng_MRG31k3p (void *dummy);
 void unur_urng_MRG31k3p_seed (void *dummy, unsigned long seed);
 void unur_urng_MRG31k3p_reset (void *dummy);
+UNUR_URNG *unur_urng_MRG31k3p_new( unsigned long seed );
+UNUR_URNG *unur_urng_philox_new( unsigned long seed, unsigned long stream );
+double unur_urng_philox (void *state);
+unsigned int unur_urng_philox_array (void *state, double *X, int dim);
+void unur_urng_philox_seed (void *state, unsigned long seed);
+void unur_urng_philox_reset (void *state);
+void unur_urng_philox_nextsub (void *state);
+void unur_urng_philox_resetsub (void *state);
+int unur_urng_philox_set_stream( UNUR_URNG *urng, unsigned long stream );
 double unur_urng_fish (void *dummy);
 void unur_urng_fish_seed (void *dummy, unsigned long seed);
 void unur_urng_fish_reset (void *dummy);
@@ -154,6 +168,9 @@ UNUR_FUNCT_CONT *unur_distr_cont_get_logcdf( const UNUR_DISTR *distribution );
 double unur_distr_cont_eval_logpdf( double x, const UNUR_DISTR *distribution );
 double unur_distr_cont_eval_dlogpdf( double x, const UNUR_DISTR *distribution );
 double unur_distr_cont_eval_logcdf( double x, const UNUR_DISTR *distribution );
+int unur_distr_cont_set_pdf_array( UNUR_DISTR *distribution, UNUR_FUNCT_CONT_ARRAY *pdf_array );
+int unur_distr_cont_set_logpdf_array( UNUR_DISTR *distribution, UNUR_FUNCT_CONT_ARRAY *logpdf_array );
+int unur_distr_cont_eval_pdf_array( const double *x, double *fx, int n, const UNUR_DISTR *distribution );
 int unur_distr_cont_set_pdfstr( UNUR_DISTR *distribution, const char *pdfstr );
 int unur_distr_cont_set_cdfstr( UNUR_DISTR *distribution, const char *cdfstr );
 char *unur_distr_cont_get_pdfstr( const UNUR_DISTR *distribution );
@@ -328,6 +345,7 @@ int unur_dgt_set_guidefactor( UNUR_PAR *parameters, double factor );
 int unur_dgt_set_variant( UNUR_PAR *parameters, unsigned variant );
 int unur_dgt_eval_invcdf_recycle( const UNUR_GEN *generator, double u, double *recycle );
 int unur_dgt_eval_invcdf( const UNUR_GEN *generator, double u );
+int unur_dgt_eval_invcdf_sorted( const UNUR_GEN *generator, const double *U, double *X, int n );
 UNUR_PAR *unur_dsrou_new( const UNUR_DISTR *distribution );
 int unur_dsrou_set_cdfatmode( UNUR_PAR *parameters, double Fmode );
 int unur_dsrou_set_verify( UNUR_PAR *parameters, int verify );
@@ -370,6 +388,7 @@ int unur_hinv_set_guidefactor( UNUR_PAR *parameters, double factor );
 int unur_hinv_set_max_intervals( UNUR_PAR *parameters, int max_ivs );
 int unur_hinv_get_n_intervals( const UNUR_GEN *generator );
 double unur_hinv_eval_approxinvcdf( const UNUR_GEN *generator, double u );
+int unur_hinv_eval_approxinvcdf_sorted( const UNUR_GEN *generator, const double *U, double *X, int n );
 int unur_hinv_chg_truncated( UNUR_GEN *generator, double left, double right );
 int unur_hinv_estimate_error( const UNUR_GEN *generator, int samplesize, double *max_error, double *MAE );
 UNUR_PAR *unur_hrb_new( const UNUR_DISTR *distribution );
@@ -430,9 +449,12 @@ int unur_pinv_set_usecdf( UNUR_PAR *parameters );
 int unur_pinv_set_boundary( UNUR_PAR *parameters, double left, double right );
 int unur_pinv_set_searchboundary( UNUR_PAR *parameters, int left, int right );
 int unur_pinv_set_max_intervals( UNUR_PAR *parameters, int max_ivs );
+int unur_pinv_set_threads( UNUR_PAR *parameters, int threads );
 int unur_pinv_get_n_intervals( const UNUR_GEN *generator ); 
 int unur_pinv_set_keepcdf( UNUR_PAR *parameters, int keepcdf);
 double unur_pinv_eval_approxinvcdf( const UNUR_GEN *generator, double u );
+int unur_pinv_eval_approxinvcdf_array( const UNUR_GEN *generator, const double *U, double *X, int n );
+int unur_pinv_eval_approxinvcdf_sorted( const UNUR_GEN *generator, const double *U, double *X, int n );
 double unur_pinv_eval_approxcdf( const UNUR_GEN *generator, double x );
 int unur_pinv_estimate_error( const UNUR_GEN *generator, int samplesize, double *max_error, double *MAE );
 UNUR_PAR *unur_srou_new( const UNUR_DISTR *distribution );
@@ -502,6 +524,7 @@ int unur_tdr_set_pedantic( UNUR_PAR *parameters, int pedantic );
 double unur_tdr_eval_invcdfhat( const UNUR_GEN *generator, double u, 
 				double *hx, double *fx, double *sqx );
 int _unur_tdr_is_ARS_running( const UNUR_GEN *generator );
+int unur_tdr_freeze_hat( UNUR_GEN *generator );
 UNUR_PAR *unur_utdr_new( const UNUR_DISTR *distribution );
 int unur_utdr_set_pdfatmode( UNUR_PAR *parameters, double fmode );
 int unur_utdr_set_cpfactor( UNUR_PAR *parameters, double cp_factor );
@@ -575,14 +598,17 @@ int unur_hitro_reset_state( UNUR_GEN *generator );
 UNUR_PAR *unur_cstd_new( const UNUR_DISTR *distribution );
 int unur_cstd_set_variant( UNUR_PAR *parameters, unsigned variant );
 int unur_cstd_chg_truncated( UNUR_GEN *generator, double left, double right );
+int unur_cstd_sample_params( UNUR_GEN *generator, const double *params, int n_params, double *X, int n );
 double unur_cstd_eval_invcdf( const UNUR_GEN *generator, double u );
 UNUR_PAR *unur_dstd_new( const UNUR_DISTR *distribution );
 int unur_dstd_set_variant( UNUR_PAR *parameters, unsigned variant );
 int unur_dstd_chg_truncated( UNUR_GEN *generator, int left, int right );
+int unur_dstd_sample_params( UNUR_GEN *generator, const double *params, int n_params, int *K, int n );
 int unur_dstd_eval_invcdf( const UNUR_GEN *generator, double u );
 UNUR_PAR *unur_mvstd_new( const UNUR_DISTR *distribution );
 UNUR_PAR *unur_mixt_new( int n, const double *prob, UNUR_GEN **comp );
 int unur_mixt_set_useinversion( UNUR_PAR *parameters, int useinv );
+int unur_mixt_set_grouped( UNUR_PAR *parameters, int grouped );
 double unur_mixt_eval_invcdf( const UNUR_GEN *generator, double u );
 UNUR_PAR *unur_cext_new( const UNUR_DISTR *distribution );
 int unur_cext_set_init( UNUR_PAR *parameters, int (*init)(UNUR_GEN *gen) );
@@ -734,9 +760,13 @@ UNUR_GEN *unur_init( UNUR_PAR *parameters );
 int unur_reinit( UNUR_GEN *generator );
 int    unur_sample_discr(UNUR_GEN *generator);
 double unur_sample_cont(UNUR_GEN *generator);
+int    unur_sample_discr_array(UNUR_GEN *generator, int *K, int n);
+int    unur_sample_cont_array(UNUR_GEN *generator, double *X, int n);
 int    unur_sample_vec(UNUR_GEN *generator, double *vector);
+int    unur_sample_vec_array(UNUR_GEN *generator, double *X, int n);
 int    unur_sample_matr(UNUR_GEN *generator, double *matrix);
 double unur_quantile ( UNUR_GEN *generator, double U );
+int unur_quantile_array ( UNUR_GEN *generator, const double *U, double *X, int n );
 void  unur_free( UNUR_GEN *generator );
 const char *unur_gen_info( UNUR_GEN *generator, int help );
 int unur_get_dimension( const UNUR_GEN *generator );
@@ -746,6 +776,16 @@ int unur_gen_is_inversion ( const UNUR_GEN *gen );
 UNUR_DISTR *unur_get_distr( const UNUR_GEN *generator );
 int unur_set_use_distr_privatecopy( UNUR_PAR *parameters, int use_privatecopy );
 UNUR_GEN *unur_gen_clone( const UNUR_GEN *gen );
+UNUR_GEN *unur_gen_share( UNUR_GEN *gen );
+int unur_gen_share_merge( UNUR_GEN *shared );
+#define UNUR_GEN_N_COUNTERS (7)
+int unur_gen_set_counters( UNUR_GEN *generator, int count );
+int unur_gen_get_counters( const UNUR_GEN *generator, double *counts );
+int unur_gen_reset_counters( UNUR_GEN *generator );
+int unur_gen_add_counters( UNUR_GEN *generator, const UNUR_GEN *other );
+int unur_set_default_profiling( int profile );
+int unur_gen_get_n_setup_phases( const UNUR_GEN *generator );
+const char *unur_gen_get_setup_phase( const UNUR_GEN *generator, int phase, double *stats );
 void unur_par_free( UNUR_PAR *par);
 #ifndef UNURAN_DISTRIBUTIONS_H_SEEN
 #define UNURAN_DISTRIBUTIONS_H_SEEN
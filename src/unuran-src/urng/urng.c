@@ -21,7 +21,19 @@ unur_urng_sample_array (UNUR_URNG *urng, double *X, int dim)
 {
   if (urng == NULL) 
     urng = unur_get_default_urng();
+#ifdef UNUR_URNG_UNURAN
+  if (urng->buffer_pos < urng->buffer_end) {
+    int i;
+    for (i=0; i<dim && urng->buffer_pos < urng->buffer_end; i++)
+      X[i] = urng->buffer[urng->buffer_pos++];
+    urng->n_calls += i;
+    if (i < dim)
+      unur_urng_sample_array(urng, X+i, dim-i);
+    return dim;
+  }
+#endif
   if (urng->samplearray) {
+    urng->n_calls += dim;
     return (urng->samplearray(urng->state,X,dim));
   }
   else {
@@ -32,12 +44,29 @@ unur_urng_sample_array (UNUR_URNG *urng, double *X, int dim)
   }
 }  
 int
+unur_urng_sample_sorted (UNUR_URNG *urng, double *X, int n)
+{
+  int i;
+  double S;
+  if (urng == NULL) 
+    urng = unur_get_default_urng();
+  if (n <= 0) return 0;
+  unur_urng_sample_array(urng, X, n);
+  for (S=0., i=0; i<n; i++)
+    X[i] = (S -= log(1.-X[i]));
+  S -= log(1.-_unur_call_urng(urng));
+  for (i=0; i<n; i++)
+    X[i] /= S;
+  return n;
+}  
+int
 unur_urng_reset (UNUR_URNG *urng)
 {
   if (urng == NULL) 
     urng = unur_get_default_urng();
 #ifdef UNUR_URNG_UNURAN
   COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  urng->buffer_pos = urng->buffer_end = 0;
   if (urng->reset != NULL) {
     urng->reset (urng->state);
     return UNUR_SUCCESS;
@@ -18,6 +18,7 @@ UNUR_URNG *unur_get_urng_aux( UNUR_GEN *generator );
 double unur_urng_sample (UNUR_URNG *urng);
 double unur_sample_urng (UNUR_GEN *gen);
 int unur_urng_sample_array (UNUR_URNG *urng, double *X, int dim);
+int unur_urng_sample_sorted (UNUR_URNG *urng, double *X, int n);
 int unur_urng_reset (UNUR_URNG *urng);
 #ifdef UNUR_URNG_UNURAN
 int unur_urng_sync (UNUR_URNG *urng);
@@ -34,6 +35,9 @@ int unur_gen_resetsub (UNUR_GEN *generator);
 UNUR_URNG *unur_urng_new( double (*sampleunif)(void *state), void *state );
 void unur_urng_free (UNUR_URNG *urng);
 int unur_urng_set_sample_array( UNUR_URNG *urng, unsigned int (*samplearray)(void *state, double *X, int dim) );
+int unur_urng_set_buffer( UNUR_URNG *urng, int size );
+int unur_urng_get_buffer_size( UNUR_URNG *urng );
+int unur_urng_flush_buffer( UNUR_URNG *urng );
 int unur_urng_set_sync( UNUR_URNG *urng, void (*sync)(void *state) );
 int unur_urng_set_seed( UNUR_URNG *urng, void (*setseed)(void *state, unsigned long seed) );
 int unur_urng_set_anti( UNUR_URNG *urng, void (*setanti)(void *state, int anti) );
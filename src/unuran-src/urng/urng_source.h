@@ -4,7 +4,19 @@
 #ifndef URNG_SOURCE_H_SEEN
 #define URNG_SOURCE_H_SEEN
 #ifdef UNUR_URNG_UNURAN
-#define _unur_call_urng(urng)    ((urng)->sampleunif((urng)->state))
+#define _unur_call_urng(urng)    (_unur_urng_sampleunif(urng))
+#define UNUR_URNG_BUFFER_ALIGN (64)
+double _unur_urng_buffer_refill( struct unur_urng *urng );
+static inline double
+_unur_urng_sampleunif( struct unur_urng *urng )
+{
+  ++(urng->n_calls);
+  if (urng->buffer_pos < urng->buffer_end)
+    return urng->buffer[urng->buffer_pos++];
+  if (urng->buffer == NULL)
+    return urng->sampleunif(urng->state);
+  return _unur_urng_buffer_refill(urng);
+}
 #else
 #error
 #error UNUR_URNG changed!
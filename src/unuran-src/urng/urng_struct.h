@@ -5,6 +5,12 @@ struct unur_urng {
   double (*sampleunif)(void *state);  
   void *state;                        
   unsigned int (*samplearray)(void *state, double *X, int dim);
+  double *buffer;                     
+  int buffer_size;                    
+  int buffer_pos;                     
+  int buffer_end;                     
+  unsigned long n_calls;              
+  void *buffer_mem;                   
   void (*sync)(void *state);          
   unsigned long seed;                 
   void (*setseed)(void *state, unsigned long seed);  
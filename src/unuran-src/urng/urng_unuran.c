@@ -13,6 +13,12 @@ unur_urng_new( double (*sampleunif)(void *state), void *state )
   urng->sampleunif = sampleunif;
   urng->state      = state;
   urng->samplearray = NULL;
+  urng->buffer      = NULL;
+  urng->buffer_size = 0;
+  urng->buffer_pos  = 0;
+  urng->buffer_end  = 0;
+  urng->n_calls     = 0ul;
+  urng->buffer_mem  = NULL;
   urng->sync     = NULL;
   urng->seed     = ULONG_MAX;
   urng->setseed  = NULL;
@@ -34,6 +40,59 @@ unur_urng_set_sample_array( UNUR_URNG *urng,
   return UNUR_SUCCESS;
 } 
 int
+unur_urng_set_buffer( UNUR_URNG *urng, int size )
+{
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );
+  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  if (size < 0) {
+    _unur_warning("URNG",UNUR_ERR_PAR_SET,"buffer size < 0");
+    return UNUR_ERR_PAR_SET;
+  }
+  if (urng->buffer_mem) free (urng->buffer_mem);
+  urng->buffer = NULL;
+  urng->buffer_mem = NULL;
+  urng->buffer_size = 0;
+  urng->buffer_pos = urng->buffer_end = 0;
+  if (size > 0) {
+    urng->buffer_mem = _unur_xmalloc( size*sizeof(double) + UNUR_URNG_BUFFER_ALIGN );
+    urng->buffer = (double *) ( ((size_t) urng->buffer_mem + UNUR_URNG_BUFFER_ALIGN - 1)
+				& ~((size_t) UNUR_URNG_BUFFER_ALIGN - 1) );
+    urng->buffer_size = size;
+  }
+  return UNUR_SUCCESS;
+} 
+int
+unur_urng_get_buffer_size( UNUR_URNG *urng )
+{
+  _unur_check_NULL( "URNG", urng, -1 );
+  return urng->buffer_size;
+} 
+int
+unur_urng_flush_buffer( UNUR_URNG *urng )
+{
+  _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );
+  COOKIE_CHECK(urng,CK_URNG,UNUR_ERR_COOKIE);
+  urng->buffer_pos = urng->buffer_end = 0;
+  return UNUR_SUCCESS;
+} 
+double
+_unur_urng_buffer_refill( struct unur_urng *urng )
+{
+  int i;
+  if (urng->samplearray) {
+    i = (int) urng->samplearray(urng->state, urng->buffer, urng->buffer_size);
+    if (i <= 0) 
+      return urng->sampleunif(urng->state);
+  }
+  else {
+    for (i=0; i<urng->buffer_size; i++)
+      urng->buffer[i] = urng->sampleunif(urng->state);
+  }
+  urng->buffer_end = i;
+  urng->buffer_pos = 1;
+  return urng->buffer[0];
+} 
+int
 unur_urng_set_sync( UNUR_URNG *urng, void (*sync)(void *state) )
 {
   _unur_check_NULL( "URNG", urng, UNUR_ERR_NULL );
@@ -112,6 +171,7 @@ unur_urng_seed (UNUR_URNG *urng, unsigned long seed)
     _unur_error("URNG",UNUR_ERR_URNG_MISS,"seeding function");
     return UNUR_ERR_URNG_MISS;
   }
+  urng->buffer_pos = urng->buffer_end = 0;
   urng->setseed (urng->state,seed);
   urng->seed = seed;
   return UNUR_SUCCESS;
@@ -126,6 +186,7 @@ unur_urng_anti (UNUR_URNG *urng, int anti)
     _unur_error("URNG",UNUR_ERR_URNG_MISS,"antithetic flag");
     return UNUR_ERR_URNG_MISS;
   }
+  urng->buffer_pos = urng->buffer_end = 0;
   urng->anti (urng->state,anti);
   return UNUR_SUCCESS;
 }  
@@ -139,6 +200,7 @@ unur_urng_nextsub (UNUR_URNG *urng)
     _unur_error("URNG",UNUR_ERR_URNG_MISS,"next substream");
     return UNUR_ERR_URNG_MISS;
   }
+  urng->buffer_pos = urng->buffer_end = 0;
   urng->nextsub (urng->state);
   return UNUR_SUCCESS;
 }  
@@ -152,6 +214,7 @@ unur_urng_resetsub (UNUR_URNG *urng)
     _unur_error("URNG",UNUR_ERR_URNG_MISS,"reset substream");
     return UNUR_ERR_URNG_MISS;
   }
+  urng->buffer_pos = urng->buffer_end = 0;
   urng->resetsub (urng->state);
   return UNUR_SUCCESS;
 }  
@@ -161,6 +224,7 @@ unur_urng_free (UNUR_URNG *urng)
   if (urng == NULL) return;  
   COOKIE_CHECK(urng,CK_URNG,RETURN_VOID);
   if (urng->delete != NULL) urng->delete (urng->state);
+  if (urng->buffer_mem) free (urng->buffer_mem);
   free (urng);
   urng = NULL;
   return;
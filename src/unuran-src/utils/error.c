@@ -11,7 +11,11 @@ _unur_error_x( const char *objid, const char *file, int line,
 	       const char *errortype, int errorcode, const char *reason )
 {
   _unur_error_handler(objid, file, line, errortype, errorcode, reason);
+#if defined(__GNUC__)
+  __atomic_store_n(&unur_errno, errorcode, __ATOMIC_RELAXED);
+#else
   unur_errno = errorcode;
+#endif
 } 
 void
 _unur_error_handler_default( const char *objid, const char *file, int line, 
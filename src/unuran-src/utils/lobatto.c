@@ -4,15 +4,20 @@
 #include <unur_source.h>
 #include "lobatto_source.h"
 #include "lobatto_struct.h"
+static void
+_unur_lobatto_eval_nodes (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+			  struct unur_gen *gen, const double *x, double *fx, int n);
 static double 
-_unur_lobatto5_simple (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
-		       double x, double h, double *fx);
+_unur_lobatto5_simple (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+		       struct unur_gen *gen, double x, double h, double *fx);
 static double
-_unur_lobatto5_adaptive (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
+_unur_lobatto5_adaptive (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+			 struct unur_gen *gen,
 			 double x, double h, double tol, UNUR_LOBATTO_ERROR uerror,
 			 struct unur_lobatto_table *Itable);
 static double 
-_unur_lobatto5_recursion (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
+_unur_lobatto5_recursion (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+			  struct unur_gen *gen,
 			  double x, double h, double tol, UNUR_LOBATTO_ERROR uerror,
 			  double int1, double fl, double fr, double fc,
 			  int *W_accuracy, int *n_calls,
@@ -22,35 +27,53 @@ _unur_lobatto_table_append (struct unur_lobatto_table *Itable, double x, double
 static void
 _unur_lobatto_table_resize (struct unur_lobatto_table *Itable);
 #define FKT(x)  (funct((x),gen))      
+#define FKT_ARRAY(x,fx,n)  (_unur_lobatto_eval_nodes(funct,funct_array,gen,(x),(fx),(n)))
 #define W1 (0.17267316464601146)   
 #define W2 (1.-W1)
 #define LOBATTO_MAX_CALLS (1000000)
+void
+_unur_lobatto_eval_nodes (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+			  struct unur_gen *gen, const double *x, double *fx, int n)
+{
+  int i;
+  if (funct_array != NULL && funct_array(x,fx,n,gen) == UNUR_SUCCESS)
+    return;
+  for (i=0; i<n; i++)
+    fx[i] = FKT(x[i]);
+} 
 double
-_unur_lobatto5_simple (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
-		       double x, double h, double *fx)
+_unur_lobatto5_simple (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+		       struct unur_gen *gen, double x, double h, double *fx)
 { 
+  double xv[5], fv[5];  
   double fl, fr;
-  if (fx==NULL) {
-    fl = FKT(x);
-    fr = FKT(x+h);
-  }
-  else {
-    fl = (*fx>=0.) ? *fx : FKT(x);
-    fr = *fx = FKT(x+h);
-  }
-  return (9*(fl+fr)+49.*(FKT(x+h*W1)+FKT(x+h*W2))+64*FKT(x+h/2.))*h/180.;
+  int nl;               
+  nl = (fx==NULL || *fx<0.) ? 1 : 0;
+  xv[0] = x;
+  xv[1] = x+h*W1;
+  xv[2] = x+h*W2;
+  xv[3] = x+h/2.;
+  xv[4] = x+h;
+  FKT_ARRAY(xv+1-nl, fv+1-nl, 4+nl);
+  fl = (nl) ? fv[0] : *fx;
+  fr = fv[4];
+  if (fx!=NULL) *fx = fr;
+  return (9*(fl+fr)+49.*(fv[1]+fv[2])+64*fv[3])*h/180.;
 } 
 double
-_unur_lobatto_adaptive (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
+_unur_lobatto_adaptive (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+			struct unur_gen *gen,
 			double x, double h, double tol, UNUR_LOBATTO_ERROR uerror)
 {
-  return _unur_lobatto5_adaptive(funct,gen,x,h,tol,uerror,NULL); 
+  return _unur_lobatto5_adaptive(funct,funct_array,gen,x,h,tol,uerror,NULL); 
 } 
 double
-_unur_lobatto5_adaptive (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen, 
+_unur_lobatto5_adaptive (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+			 struct unur_gen *gen, 
 			 double x, double h, double tol, UNUR_LOBATTO_ERROR uerror,
 			 struct unur_lobatto_table *Itable)
 {
+  double xv[5], fv[5];  
   double fl, fc, fr;  
   double int1, int2;  
   int W_accuracy = 0; 
@@ -61,11 +84,17 @@ _unur_lobatto5_adaptive (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
     _unur_error(gen->genid,UNUR_ERR_INF,"boundaries of integration domain not finite");
     return UNUR_INFINITY;
   }
-  fl = FKT(x);
-  fc = FKT(x+h/2.);
-  fr = FKT(x+h);
-  int1 = (9*(fl+fr)+49.*(FKT(x+h*W1)+FKT(x+h*W2))+64*fc)*h/180.;
-  int2 = _unur_lobatto5_recursion(funct,gen,x,h,tol,uerror,int1,fl,fc,fr,&W_accuracy,&n_calls,Itable);
+  xv[0] = x;
+  xv[1] = x+h/2.;
+  xv[2] = x+h;
+  xv[3] = x+h*W1;
+  xv[4] = x+h*W2;
+  FKT_ARRAY(xv,fv,5);
+  fl = fv[0];
+  fc = fv[1];
+  fr = fv[2];
+  int1 = (9*(fl+fr)+49.*(fv[3]+fv[4])+64*fc)*h/180.;
+  int2 = _unur_lobatto5_recursion(funct,funct_array,gen,x,h,tol,uerror,int1,fl,fc,fr,&W_accuracy,&n_calls,Itable);
   if (W_accuracy) {
     if (W_accuracy == 1)
       _unur_warning(gen->genid,UNUR_ERR_ROUNDOFF,
@@ -77,12 +106,14 @@ _unur_lobatto5_adaptive (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
   return int2;
 } 
 double
-_unur_lobatto5_recursion (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
+_unur_lobatto5_recursion (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+			  struct unur_gen *gen,
 			  double x, double h, double tol, UNUR_LOBATTO_ERROR uerror,
 			  double int1, double fl, double fc, double fr,
 			  int *W_accuracy, int *n_calls,
 			  struct unur_lobatto_table *Itable)
 {
+  double xv[6], fv[6];  
   double flc, frc;    
   double int2;        
   double intl, intr;  
@@ -91,10 +122,17 @@ _unur_lobatto5_recursion (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
     *W_accuracy = 2;
     return UNUR_INFINITY;
   }
-  flc = FKT(x+h/4);
-  frc = FKT(x+3*h/4);
-  intl = (9*(fl+fc)+49.*(FKT(x+h*W1*0.5)+FKT(x+h*W2*0.5))+64*flc)*h/360.;
-  intr = (9*(fc+fr)+49.*(FKT(x+h*(0.5+W1*0.5))+FKT(x+h*(0.5+W2*0.5)))+64*frc)*h/360.;
+  xv[0] = x+h/4;
+  xv[1] = x+3*h/4;
+  xv[2] = x+h*W1*0.5;
+  xv[3] = x+h*W2*0.5;
+  xv[4] = x+h*(0.5+W1*0.5);
+  xv[5] = x+h*(0.5+W2*0.5);
+  FKT_ARRAY(xv,fv,6);
+  flc = fv[0];
+  frc = fv[1];
+  intl = (9*(fl+fc)+49.*(fv[2]+fv[3])+64*flc)*h/360.;
+  intr = (9*(fc+fr)+49.*(fv[4]+fv[5])+64*frc)*h/360.;
   int2 = intl + intr;
   if (uerror!=NULL)
     ierror = uerror(gen, fabs(int1-int2), x+h/2.);
@@ -105,9 +143,9 @@ _unur_lobatto5_recursion (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
       *W_accuracy = 1;
     }
     else {
-      int2  = _unur_lobatto5_recursion(funct,gen,x,h/2,tol/1.,uerror,
+      int2  = _unur_lobatto5_recursion(funct,funct_array,gen,x,h/2,tol/1.,uerror,
 				       intl,fl,flc,fc, W_accuracy,n_calls, Itable);
-      int2 += _unur_lobatto5_recursion(funct,gen,x+h/2,h/2,tol/1.,uerror,
+      int2 += _unur_lobatto5_recursion(funct,funct_array,gen,x+h/2,h/2,tol/1.,uerror,
 				       intr,fc,frc,fr, W_accuracy,n_calls, Itable);
       return int2;
     }
@@ -136,7 +174,7 @@ _unur_lobatto_eval_diff (struct unur_lobatto_table *Itable, double x, double h,
   }
   if (x < Itable->bleft || x+h > Itable->bright) {
     clear_fx();
-    return _unur_lobatto5_adaptive(Itable->funct, Itable->gen, x, h, 
+    return _unur_lobatto5_adaptive(Itable->funct, Itable->funct_array, Itable->gen, x, h, 
 				   Itable->tol, Itable->uerror, NULL);
   }
   cur = Itable->cur_iv;
@@ -144,16 +182,16 @@ _unur_lobatto_eval_diff (struct unur_lobatto_table *Itable, double x, double h,
     ++cur;
   if (cur >= n_values) {
     clear_fx();
-    return _unur_lobatto5_adaptive(Itable->funct, Itable->gen, x, h, 
+    return _unur_lobatto5_adaptive(Itable->funct, Itable->funct_array, Itable->gen, x, h, 
 				   Itable->tol, Itable->uerror, NULL);
   }
   x1 = values[cur].x;
   ++cur;
   if (cur >= n_values ||
       values[cur].x > x+h) {
-    return _unur_lobatto5_simple(Itable->funct, Itable->gen, x, h, fx);
+    return _unur_lobatto5_simple(Itable->funct, Itable->funct_array, Itable->gen, x, h, fx);
   }
-  Q = _unur_lobatto5_simple(Itable->funct, Itable->gen, x, x1-x, fx);
+  Q = _unur_lobatto5_simple(Itable->funct, Itable->funct_array, Itable->gen, x, x1-x, fx);
   do {
     Q += values[cur].u;
     x1 = values[cur].x;
@@ -161,11 +199,11 @@ _unur_lobatto_eval_diff (struct unur_lobatto_table *Itable, double x, double h,
   } while (cur < n_values && values[cur].x <= x+h);
   clear_fx();
   if (cur >= n_values) {
-    Q += _unur_lobatto5_adaptive(Itable->funct, Itable->gen, x1, x+h-x1,
+    Q += _unur_lobatto5_adaptive(Itable->funct, Itable->funct_array, Itable->gen, x1, x+h-x1,
 				 Itable->tol, Itable->uerror, NULL);
   }
   else {
-    Q += _unur_lobatto5_simple(Itable->funct, Itable->gen, x1, x+h-x1, fx);
+    Q += _unur_lobatto5_simple(Itable->funct, Itable->funct_array, Itable->gen, x1, x+h-x1, fx);
   }
   return Q;
 #undef clear_fx
@@ -196,11 +234,11 @@ _unur_lobatto_eval_CDF (struct unur_lobatto_table *Itable, double x)
     xr = values[cur].x;
   }
   if (cur >= n_values) {
-    cdf += _unur_lobatto5_adaptive(Itable->funct, Itable->gen, xr, x-xr,
+    cdf += _unur_lobatto5_adaptive(Itable->funct, Itable->funct_array, Itable->gen, xr, x-xr,
 				   Itable->tol, Itable->uerror, NULL);
   }
   else {
-    cdf += _unur_lobatto5_simple(Itable->funct, Itable->gen, xr, x-xr, NULL);
+    cdf += _unur_lobatto5_simple(Itable->funct, Itable->funct_array, Itable->gen, xr, x-xr, NULL);
   }
   cdf /= area;
   cdf = _unur_max(0., cdf);
@@ -214,7 +252,8 @@ _unur_lobatto_integral (struct unur_lobatto_table *Itable)
   return Itable->integral;
 } 
 struct unur_lobatto_table *
-_unur_lobatto_init (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
+_unur_lobatto_init (UNUR_LOBATTO_FUNCT funct, UNUR_LOBATTO_FUNCT_ARRAY funct_array,
+		    struct unur_gen *gen,
 		    double left, double center, double right,
 		    double tol, UNUR_LOBATTO_ERROR uerror, int size)
 {
@@ -229,6 +268,7 @@ _unur_lobatto_init (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
   Itable->n_values = 0;
   Itable->cur_iv = 0;
   Itable->funct = funct;
+  Itable->funct_array = funct_array;
   Itable->gen = gen;
   Itable->bleft = left;
   Itable->bright = right;
@@ -236,9 +276,9 @@ _unur_lobatto_init (UNUR_LOBATTO_FUNCT funct, struct unur_gen *gen,
   Itable->uerror = uerror;
   _unur_lobatto_table_append(Itable,left,0.);
   Itable->integral = 
-    _unur_lobatto5_adaptive(funct, gen, left, center-left, tol, uerror, Itable );
+    _unur_lobatto5_adaptive(funct, funct_array, gen, left, center-left, tol, uerror, Itable );
   Itable->integral += 
-    _unur_lobatto5_adaptive(funct, gen, center, right-center, tol, uerror, Itable );
+    _unur_lobatto5_adaptive(funct, funct_array, gen, center, right-center, tol, uerror, Itable );
   _unur_lobatto_table_resize(Itable);
   return Itable;
 } 
@@ -254,6 +294,50 @@ int _unur_lobatto_find_linear (struct unur_lobatto_table *Itable, double x)
     return UNUR_ERR_SILENT;
   }
 } 
+struct unur_lobatto_table *
+_unur_lobatto_share (const struct unur_lobatto_table *Itable)
+{
+  struct unur_lobatto_table *share;
+  CHECK_NULL(Itable, NULL);
+  share = _unur_xmalloc( sizeof(struct unur_lobatto_table) );
+  memcpy(share, Itable, sizeof(struct unur_lobatto_table));
+  share->cur_iv = 0;
+  return share;
+} 
+void
+_unur_lobatto_share_free (struct unur_lobatto_table **Itable)
+{
+  if (*Itable) {
+    free (*Itable);
+    *Itable = NULL;
+  }
+} 
+int
+_unur_lobatto_partition (const struct unur_lobatto_table *Itable, int n, double *x)
+{
+  double area, sum;
+  int i, cur;
+  CHECK_NULL(Itable, UNUR_ERR_NULL);
+  if (n < 1 || Itable->n_values <= n)
+    return UNUR_ERR_SILENT;
+  area = Itable->integral;
+  if (!(area > 0.))
+    return UNUR_ERR_SILENT;
+  x[0] = Itable->bleft;
+  sum = 0.;
+  cur = 0;
+  for (i=1; i<n; i++) {
+    while (cur < Itable->n_values-1 && (sum < i * area / n || !(Itable->values[cur].x > x[i-1])) )
+      sum += Itable->values[++cur].u;
+    x[i] = Itable->values[cur].x;
+    if (!(x[i] > x[i-1]))
+      return UNUR_ERR_SILENT;
+  }
+  x[n] = Itable->bright;
+  if (!(x[n] > x[n-1]))
+    return UNUR_ERR_SILENT;
+  return UNUR_SUCCESS;
+} 
 int
 _unur_lobatto_table_append (struct unur_lobatto_table *Itable, double x, double u)
 {
@@ -11,6 +11,7 @@ struct unur_lobatto_table {
   int cur_iv;                
   int size;                  
   UNUR_LOBATTO_FUNCT *funct; 
+  UNUR_LOBATTO_FUNCT_ARRAY *funct_array; 
   struct unur_gen *gen;      
   double tol;                
   UNUR_LOBATTO_ERROR *uerror; 
@@ -5,10 +5,17 @@
 #ifdef R_UNURAN
 #include <R_ext/Error.h>
 #endif
+static size_t *_unur_xmalloc_counter = NULL;
+void
+_unur_xmalloc_set_counter(size_t *counter)
+{
+  _unur_xmalloc_counter = counter;
+} 
 void*
 _unur_xmalloc(size_t size)
 {
   register void *ptr;
+  if (_unur_xmalloc_counter) *_unur_xmalloc_counter += size;
   ptr = malloc( size );
   if (ptr == NULL) {
     _unur_error(NULL,UNUR_ERR_MALLOC,"");
@@ -24,6 +31,7 @@ void*
 _unur_xrealloc(void *ptr, size_t size)
 {
   register void *new_ptr;
+  if (_unur_xmalloc_counter) *_unur_xmalloc_counter += size;
   new_ptr = realloc( ptr, size );
   if (new_ptr == NULL) {
     _unur_error(NULL,UNUR_ERR_MALLOC,"");
@@ -35,3 +43,180 @@ _unur_xrealloc(void *ptr, size_t size)
   }
   return new_ptr;
 } 
+#define _UNUR_ARENA_ALIGN       (16)
+#define _UNUR_ARENA_CHUNK_MIN   (4096)
+#define _UNUR_ARENA_CHUNK_MAX   (262144)
+#define _unur_arena_round(s)    (((s)+_UNUR_ARENA_ALIGN-1) & ~((size_t)_UNUR_ARENA_ALIGN-1))
+struct unur_arena_chunk {
+  struct unur_arena_chunk *next;
+  size_t size;                  
+  size_t used;                  
+};
+struct unur_arena {
+  struct unur_arena_chunk *chunk; 
+  void *freelist;               
+  size_t free_size;             
+  size_t next_size;             
+  int nothrow;                  
+};
+#define _unur_arena_data(c)  ((char*)(c) + _unur_arena_round(sizeof(struct unur_arena_chunk)))
+struct unur_arena *
+_unur_arena_new(int nothrow)
+{
+  struct unur_arena *a;
+  a = _unur_xmalloc( sizeof(struct unur_arena) );
+  a->chunk = NULL;
+  a->freelist = NULL;
+  a->free_size = 0;
+  a->next_size = _UNUR_ARENA_CHUNK_MIN;
+  a->nothrow = nothrow;
+  return a;
+} 
+void*
+_unur_arena_alloc(struct unur_arena **arena, size_t size)
+{
+  struct unur_arena *a = *arena;
+  struct unur_arena_chunk *chunk;
+  void *ptr;
+  size_t csize;
+  if (a == NULL)
+    a = *arena = _unur_arena_new(FALSE);
+  size = _unur_arena_round( (size>0) ? size : 1 );
+  if (a->freelist != NULL && size == a->free_size) {
+    ptr = a->freelist;
+    a->freelist = *((void**)ptr);
+    return ptr;
+  }
+  chunk = a->chunk;
+  if (chunk == NULL || chunk->used + size > chunk->size) {
+    csize = (size > a->next_size) ? size : a->next_size;
+    if (a->nothrow) {
+      chunk = malloc( _unur_arena_round(sizeof(struct unur_arena_chunk)) + csize );
+      if (chunk == NULL) return NULL;
+    }
+    else
+      chunk = _unur_xmalloc( _unur_arena_round(sizeof(struct unur_arena_chunk)) + csize );
+    chunk->size = csize;
+    chunk->used = 0;
+    chunk->next = a->chunk;
+    a->chunk = chunk;
+    if (a->next_size < _UNUR_ARENA_CHUNK_MAX) a->next_size *= 2;
+  }
+  ptr = _unur_arena_data(chunk) + chunk->used;
+  chunk->used += size;
+  return ptr;
+} 
+void
+_unur_arena_release(struct unur_arena *arena, void *ptr, size_t size)
+{
+  if (arena == NULL || ptr == NULL) return;
+  size = _unur_arena_round( (size>0) ? size : 1 );
+  if (arena->freelist != NULL && size != arena->free_size)
+    return;
+  *((void**)ptr) = arena->freelist;
+  arena->freelist = ptr;
+  arena->free_size = size;
+} 
+void
+_unur_arena_reset(struct unur_arena *arena)
+{
+  struct unur_arena_chunk *chunk, *next;
+  if (arena == NULL || arena->chunk == NULL) return;
+  for (chunk = arena->chunk->next; chunk != NULL; chunk = next) {
+    next = chunk->next;
+    free(chunk);
+  }
+  arena->chunk->next = NULL;
+  arena->chunk->used = 0;
+  arena->freelist = NULL;
+} 
+void
+_unur_arena_join(struct unur_arena **arena, struct unur_arena *other)
+{
+  struct unur_arena_chunk *last;
+  if (other == NULL) return;
+  if (*arena == NULL || (*arena)->chunk == NULL) {
+    if (*arena) free(*arena);
+    *arena = other;
+    other->nothrow = FALSE;
+    return;
+  }
+  if (other->chunk != NULL) {
+    for (last = other->chunk; last->next != NULL; last = last->next) ;
+    last->next = (*arena)->chunk->next;
+    (*arena)->chunk->next = other->chunk;
+  }
+  free(other);
+} 
+void
+_unur_arena_free(struct unur_arena **arena)
+{
+  struct unur_arena_chunk *chunk, *next;
+  if (*arena == NULL) return;
+  for (chunk = (*arena)->chunk; chunk != NULL; chunk = next) {
+    next = chunk->next;
+    free(chunk);
+  }
+  free(*arena);
+  *arena = NULL;
+} 
+struct unur_shared_header {
+  size_t refcount;              
+  size_t size;                  
+};
+#define _unur_shared_header(ptr)  ((struct unur_shared_header *)(ptr) - 1)
+#if defined(__GNUC__)
+#  define _unur_shared_incr(h)  __atomic_add_fetch(&((h)->refcount),1,__ATOMIC_RELAXED)
+#  define _unur_shared_decr(h)  __atomic_sub_fetch(&((h)->refcount),1,__ATOMIC_ACQ_REL)
+#  define _unur_shared_count(h) __atomic_load_n(&((h)->refcount),__ATOMIC_ACQUIRE)
+#else
+#  define _unur_shared_incr(h)  (++((h)->refcount))
+#  define _unur_shared_decr(h)  (--((h)->refcount))
+#  define _unur_shared_count(h) ((h)->refcount)
+#endif
+void*
+_unur_shared_alloc(size_t size)
+{
+  struct unur_shared_header *h;
+  h = _unur_xmalloc( sizeof(struct unur_shared_header) + size );
+  h->refcount = 1;
+  h->size = size;
+  return (void*)(h+1);
+} 
+void*
+_unur_shared_realloc(void *ptr, size_t size)
+{
+  struct unur_shared_header *h;
+  void *new_ptr;
+  if (ptr == NULL)
+    return _unur_shared_alloc(size);
+  h = _unur_shared_header(ptr);
+  if (_unur_shared_count(h) == 1) {
+    h = _unur_xrealloc( h, sizeof(struct unur_shared_header) + size );
+    h->size = size;
+    return (void*)(h+1);
+  }
+  new_ptr = _unur_shared_alloc(size);
+  memcpy( new_ptr, ptr, (size < h->size) ? size : h->size );
+  _unur_shared_free(ptr);
+  return new_ptr;
+} 
+void*
+_unur_shared_ref(void *ptr)
+{
+  struct unur_shared_header *h;
+  if (ptr == NULL) return NULL;
+  h = _unur_shared_header(ptr);
+  _unur_shared_incr(h);
+  if (_unur_xmalloc_counter) *_unur_xmalloc_counter += h->size;
+  return ptr;
+} 
+void
+_unur_shared_free(void *ptr)
+{
+  struct unur_shared_header *h;
+  if (ptr == NULL) return;
+  h = _unur_shared_header(ptr);
+  if (_unur_shared_decr(h) == 0)
+    free(h);
+} 
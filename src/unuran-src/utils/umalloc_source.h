@@ -3,3 +3,15 @@
 
 void *_unur_xmalloc(size_t size)             ATTRIBUTE__MALLOC;
 void *_unur_xrealloc(void *ptr, size_t size) ATTRIBUTE__MALLOC;
+void _unur_xmalloc_set_counter(size_t *counter);
+struct unur_arena;
+struct unur_arena *_unur_arena_new(int nothrow);
+void *_unur_arena_alloc(struct unur_arena **arena, size_t size) ATTRIBUTE__MALLOC;
+void _unur_arena_release(struct unur_arena *arena, void *ptr, size_t size);
+void _unur_arena_reset(struct unur_arena *arena);
+void _unur_arena_join(struct unur_arena **arena, struct unur_arena *other);
+void _unur_arena_free(struct unur_arena **arena);
+void *_unur_shared_alloc(size_t size) ATTRIBUTE__MALLOC;
+void *_unur_shared_realloc(void *ptr, size_t size);
+void *_unur_shared_ref(void *ptr);
+void _unur_shared_free(void *ptr);
@@ -149,6 +149,7 @@ run_verify_hat(struct unur_gen *gen, int n)
   
   /* get state for the R built-in URNG */
   GetRNGstate();
+  unur_urng_flush_buffer(unur_get_urng(gen));
 
   /* get dimension of distribution */
   dim = unur_get_dimension (gen);